@@ -2,10 +2,16 @@
  *  File Name   : addition.c
  *  Description : Source file for addition operation in the 
  *                Arbitrary Precision Calculator (APC).
- *                Implements digit-wise addition on large numbers
- *                represented as doubly linked lists.
+ *                Implements limb-wise addition on large numbers
+ *                stored as Bigint limb arrays, plus the list-based
+ *                entry point used by the calculator.
  *
  *                Functions:
+ *                - limb_add_n()
+ *                - limb_add_1()
+ *                - limb_add()
+ *                - bi_add_abs()
+ *                - bi_add()
  *                - addition()
  *
  *  Author      : Pankaj Kumar
@@ -15,6 +21,132 @@
 
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
+
+/*
+ * Function: limb_add_n
+ * --------------------
+ * Adds two limb arrays of the same length: r = a + b.
+ *
+ * Returns:
+ *   the carry out of the top limb (0 or 1).
+ */
+limb_t limb_add_n(limb_t *r, const limb_t *a, const limb_t *b, size_t n)
+{
+    limb_t carry = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        dlimb_t sum = (dlimb_t)a[i] + b[i] + carry;
+        r[i] = (limb_t)sum;
+        carry = (limb_t)(sum >> LIMB_BITS);
+    }
+    return carry;
+}
+
+/*
+ * Function: limb_add_1
+ * --------------------
+ * Adds a single limb to an array: r = a + c, stopping early once
+ * the carry dies out when r and a are the same array.
+ *
+ * Returns:
+ *   the carry out of the top limb (0 or 1).
+ */
+limb_t limb_add_1(limb_t *r, const limb_t *a, size_t n, limb_t c)
+{
+    size_t i = 0;
+
+    for (; i < n && c; i++)
+    {
+        limb_t sum = a[i] + c;
+        c = sum < c;
+        r[i] = sum;
+    }
+    if (r != a)
+        for (; i < n; i++)
+            r[i] = a[i];
+    return c;
+}
+
+/*
+ * Function: limb_add
+ * ------------------
+ * Adds a shorter array onto a longer one: r[0 .. na) = a + b, na >= nb.
+ *
+ * Returns:
+ *   the carry out of the top limb (0 or 1).
+ */
+limb_t limb_add(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+    limb_t carry = limb_add_n(r, a, b, nb);
+    return limb_add_1(r + nb, a + nb, na - nb, carry);
+}
+
+/*
+ * Function: bi_add_abs
+ * --------------------
+ * Adds the magnitudes of two Bigints: r = |a| + |b|.
+ * The result is always non-negative.
+ *
+ * Returns:
+ *   SUCCESS on success, FAILURE if memory allocation fails.
+ */
+int bi_add_abs(Bigint *r, const Bigint *a, const Bigint *b)
+{
+    /* Make a the longer operand */
+    if (a->len < b->len)
+    {
+        const Bigint *t = a;
+        a = b;
+        b = t;
+    }
+
+    size_t len_a = a->len, len_b = b->len;
+    if (bi_reserve(r, len_a + 1) == FAILURE)
+        return FAILURE;
+
+    /* Add limb-wise, then store the final carry on top */
+    r->limb[len_a] = limb_add(r->limb, a->limb, len_a, b->limb, len_b);
+    r->len = len_a + 1;
+    r->sign = 1;
+    bi_normalize(r);
+    return SUCCESS;
+}
+
+/*
+ * Function: bi_add
+ * ----------------
+ * Signed addition r = a + b.
+ * Operands with different signs are turned into a magnitude subtraction.
+ */
+int bi_add(Bigint *r, const Bigint *a, const Bigint *b)
+{
+    int sign;
+
+    if (a->sign == b->sign)
+    {
+        sign = a->sign;
+        if (bi_add_abs(r, a, b) == FAILURE)
+            return FAILURE;
+    }
+    else if (bi_cmp_abs(a, b) >= 0)
+    {
+        sign = a->sign;
+        if (bi_sub_abs(r, a, b) == FAILURE)
+            return FAILURE;
+    }
+    else
+    {
+        sign = b->sign;
+        if (bi_sub_abs(r, b, a) == FAILURE)
+            return FAILURE;
+    }
+
+    r->sign = sign;
+    bi_normalize(r);
+    return SUCCESS;
+}
 
 /*
  * Function: addition
@@ -23,7 +155,8 @@
  *
  * Each digit of the number is stored in a node of the doubly linked list.
  * The least significant digit is at the tail, and the most significant digit
- * is at the head.
+ * is at the head. The operands are converted to Bigints, added limb-wise
+ * and the sum is written back as a digit list.
  *
  * Parameters:
  *   head1, tail1 - pointers to the head and tail of the first number
@@ -32,7 +165,7 @@
  *
  * Returns:
  *   SUCCESS if addition was performed correctly,
- *   FAILURE if input lists are NULL or insertion into result fails.
+ *   FAILURE if memory allocation fails.
  */
 int addition(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
 {
@@ -40,42 +173,18 @@ int addition(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist *
     if (*head1 == NULL && *head2 == NULL)
         return SUCCESS;
 
-    /* Start from the least significant digits (tail nodes) */
-    Dlist *temp1 = *tail1;
-    Dlist *temp2 = *tail2;
-
-    int carry = 0;  // To handle carry during addition
+    Bigint a, b, r;
+    bi_init(&a);
+    bi_init(&b);
+    bi_init(&r);
 
-    /* Loop until both lists are exhausted */
-    while (temp1 || temp2)
-    {
-        /* Get current digits, if list is shorter use 0 */
-        int digit1 = temp1 ? temp1->data : 0;
-        int digit2 = temp2 ? temp2->data : 0;
-
-        /* Perform digit-wise addition with carry */
-        int sum = digit1 + digit2 + carry;
+    int status = FAILURE;
+    if (bi_from_list(&a, *head1) == SUCCESS && bi_from_list(&b, *head2) == SUCCESS &&
+        bi_add_abs(&r, &a, &b) == SUCCESS)
+        status = bi_to_list(headR, tailR, &r);
 
-        /* Update carry for next iteration */
-        carry = sum / 10;
-
-        /* Insert the resulting digit at the beginning of result list */
-        if (dl_insert_first(headR, tailR, sum % 10) == FAILURE)
-            return FAILURE;
-
-        /* Move to previous digits */
-        if (temp1)
-            temp1 = temp1->prev;
-        if (temp2)
-            temp2 = temp2->prev;
-    }
-
-    /* If there’s a leftover carry, insert it */
-    if (carry)
-    {
-        if (dl_insert_first(headR, tailR, carry) == FAILURE)
-            return FAILURE;
-    }
-    delete_leading_zero(headR, tailR);
-    return SUCCESS;
-}
\ No newline at end of file
+    bi_free(&a);
+    bi_free(&b);
+    bi_free(&r);
+    return status;
+}
@@ -1,13 +1,16 @@
 /***********************************************************************
- *  File Name   : apc_utils.c
+ *  File Name   : apc.c
  *  Description : Utility source file for the Arbitrary Precision Calculator (APC).
- *                Contains implementations for input validation, 
- *                operand conversion into doubly linked lists, 
+ *                Contains implementations for getting operand text
+ *                (from arguments, mapped files or stdin) and telling
+ *                its base, validation and conversion of a decimal
+ *                argument into a doubly linked list in one pass,
  *                operation type determination, and exponent validation.
  *
  *                Functions:
- *                - validate_input_args()
- *                - digit_to_list()
+ *                - operand_open() / operand_close()
+ *                - operand_radix()
+ *                - src_to_num()
  *                - check_operation_type()
  *                - check_exponent()
  *
@@ -16,110 +19,252 @@
  *  Date        : 07-Sep-2025
  ***********************************************************************/
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
+
+#define OPERAND_CHUNK 65536   // bytes read per call when streaming an operand
+
+/* Scanner states while an operand is read */
+enum { SCAN_LEAD, SCAN_SIGN, SCAN_DIGITS, SCAN_TRAIL };
+
+/*
+ * Reads a stream (pipe, terminal) to the end into a heap buffer,
+ * OPERAND_CHUNK bytes per call.
+ */
+static int read_stream(Dsrc *src, int fd)
+{
+	size_t cap = OPERAND_CHUNK, len = 0;
+	char *buf = malloc(cap);
+
+	while (buf)
+	{
+		if (len == cap)
+		{
+			char *grown = realloc(buf, cap *= 2);
+			if (grown == NULL)
+				break;
+			buf = grown;
+		}
+
+		ssize_t got = read(fd, buf + len, cap - len);
+		if (got <= 0)
+		{
+			if (got < 0)
+				break;
+			src->buf = buf;
+			src->text = buf;
+			src->len = len;
+			return SUCCESS;
+		}
+		len += got;
+	}
+
+	free(buf);
+	return FAILURE;
+}
+
+/*
+ * Gets the text behind a file descriptor: regular files are mapped and
+ * read in place, anything else (pipes, terminals) is read into memory.
+ */
+static int read_fd(Dsrc *src, int fd)
+{
+	struct stat st;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+	{
+		char *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED)
+		{
+			madvise(map, st.st_size, MADV_SEQUENTIAL);
+			src->map = map;
+			src->map_len = st.st_size;
+			src->text = map;
+			src->len = st.st_size;
+			return SUCCESS;
+		}
+	}
+	return read_stream(src, fd);
+}
 
 /* 
- * Function: validate_input_args
- * -----------------------------
- * Validates whether the operands passed through argv are valid numbers.
- * Accepts optional '+' or '-' sign, but ensures the rest are digits.
+ * Function: operand_open
+ * ----------------------
+ * Gets the text of one operand, without copying it where possible.
  *
- * argv : command-line arguments
+ * The operand is taken from:
+ *  "@-"    : standard input
+ *  "@path" : the file at path (memory-mapped when it is a regular file)
+ *  else    : the argument text itself
  *
  * returns:
- *   SUCCESS if both operands are valid numbers
- *   FAILURE otherwise
+ *   SUCCESS, or FAILURE if the file cannot be read or on memory
+ *   allocation failure
  */
-int validate_input_args(char **argv)
+int operand_open(Dsrc *src, const char *arg)
 {
-	int i = 0;
+	src->map = NULL;
+	src->buf = NULL;
+	src->map_len = 0;
 
-	// Validate first operand (argv[1])
-	if (argv[1][i] == '-' || argv[1][i] == '+')  // skip sign
-		i++;
-	while (argv[1][i])   // check remaining characters
+	if (arg[0] != '@')
 	{
-		if (isdigit(argv[1][i++]) == 0)  // not a digit
-			return FAILURE;
+		src->text = arg;
+		src->len = strlen(arg);
+		return SUCCESS;
 	}
+	if (strcmp(arg, "@-") == 0)
+		return read_fd(src, STDIN_FILENO);
 
-	i = 0;
-	// Validate second operand (argv[3])
-	if (argv[3][i] == '-' || argv[3][i] == '+')  // skip sign
-		i++;
-	while (argv[3][i])   // check remaining characters
+	int fd = open(arg + 1, O_RDONLY);
+	if (fd < 0)
 	{
-		if (isdigit(argv[3][i++]) == 0)  // not a digit
-			return FAILURE;
+		fprintf(stderr, "❌ ERROR: Cannot open '%s'\n", arg + 1);
+		return FAILURE;
 	}
-	return SUCCESS;
+	int status = read_fd(src, fd);
+	close(fd);
+	return status;
 }
 
-/* 
- * Function: digit_to_list
+/*
+ * Releases the mapping or buffer behind an operand's text.
+ */
+void operand_close(Dsrc *src)
+{
+	if (src->map)
+		munmap(src->map, src->map_len);
+	free(src->buf);
+	src->map = NULL;
+	src->buf = NULL;
+}
+
+/*
+ * Function: operand_radix
  * -----------------------
- * Converts string operands into doubly linked lists.
- * Each digit is stored as a separate node (MSB at head).
+ * Tells how an operand's text is written, from its first characters:
+ * 0 for a binary record, 16, 8 or 2 for text with a "0x", "0o" or
+ * "0b" prefix (after optional blanks and sign), 10 otherwise.
+ */
+int operand_radix(const Dsrc *src)
+{
+	const char *p = src->text, *end = src->text + src->len;
+
+	if (bi_is_record(p, src->len))
+		return 0;
+
+	while (p < end && isspace((unsigned char)*p))
+		p++;
+	if (p < end && (*p == '-' || *p == '+'))
+		p++;
+	if (end - p < 2 || p[0] != '0')
+		return 10;
+
+	switch (tolower((unsigned char)p[1]))
+	{
+		case 'x':
+			return 16;
+		case 'o':
+			return 8;
+		case 'b':
+			return 2;
+		default:
+			return 10;
+	}
+}
+
+/* 
+ * Function: src_to_num
+ * --------------------
+ * Validates one decimal operand and stores it into a number handle in
+ * the same pass. Each digit is stored as a separate node (MSB at head)
+ * and the operand's sign is recorded on the handle itself.
+ * Accepts optional blanks, an optional '+' or '-', at least one digit,
+ * then optional blanks (a file usually ends in a newline).
  *
- * head1, tail1 : pointers for first operand list
- * head2, tail2 : pointers for second operand list
- * argv         : command-line arguments containing operands
+ * returns:
+ *   SUCCESS if the operand is a valid number
+ *   FAILURE if it is not, or on memory allocation failure
  */
-void digit_to_list(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, char *argv[])
+int src_to_num(Dnum *num, const Dsrc *src)
 {
-	int i = 0;
-
-	/* Insert digits of operand1 */
-	if (argv[1][i] == '-' || argv[1][0] == '+') // skip sign
-		i++;
-	while (argv[1][i])  
-		dl_insert_last(head1, tail1, argv[1][i++] - '0'); // convert char → int
-
-	i = 0;
-	/* Insert digits of operand2 */
-	if (argv[3][i] == '-' || argv[3][0] == '+') // skip sign
-		i++;
-	while (argv[3][i])  
-		dl_insert_last(head2, tail2, argv[3][i++] - '0'); // convert char → int
+	int state = SCAN_LEAD;
+
+	dn_init(num);
+	for (size_t i = 0; i < src->len; i++)
+	{
+		unsigned char c = src->text[i];
+
+		if (isdigit(c))
+		{
+			if (state == SCAN_TRAIL || dn_insert_last(num, c - '0') == FAILURE)
+				return FAILURE;
+			state = SCAN_DIGITS;
+		}
+		else if (isspace(c))
+		{
+			if (state == SCAN_SIGN)
+				return FAILURE;
+			if (state == SCAN_DIGITS)
+				state = SCAN_TRAIL;
+		}
+		else if ((c == '-' || c == '+') && state == SCAN_LEAD)
+		{
+			if (c == '-')
+				num->sign = -1;
+			state = SCAN_SIGN;
+		}
+		else
+			return FAILURE;
+	}
+
+	// A number needs at least one digit
+	return state == SCAN_DIGITS || state == SCAN_TRAIL ? SUCCESS : FAILURE;
 }
 
 /* 
  * Function: check_operation_type
  * ------------------------------
- * Determines the type of arithmetic operation (+, -, x, /, %)
+ * Determines the type of arithmetic operation (+, -, x or *, /, d, %)
  * and sets the correct result sign depending on operands.
+ * Operand signs are read from the number handles.
  *
- * argv      : command-line arguments
- * head1     : head of first operand list
- * head2     : head of second operand list
+ * operator  : operator character from the command line
+ * num1      : first operand
+ * num2      : second operand
  * sign_flag : pointer to store result sign (1 = positive, -1 = negative)
  *
  * returns:
- *   operation character ('+', '-', 'x', '/', '%')
+ *   operation character ('+', '-', 'x', '/', 'd', '%')
  */
-char check_operation_type(char **argv, Dlist *head1, Dlist *head2, int *sign_flag)
+char check_operation_type(char operator, const Dnum *num1, const Dnum *num2, int *sign_flag)
 {
+	int neg1 = num1->sign < 0, neg2 = num2->sign < 0;
+
 	// Case: Addition
-	if (argv[2][0] == '+')
+	if (operator == '+')
 	{
 		// (-a) + (-b) → negative result
-		if (argv[1][0] == '-' && argv[3][0] == '-')
+		if (neg1 && neg2)
 		{
 			*sign_flag = -1;
 			return '+';
 		}
 		// (-a) + b → subtraction (sign depends on larger number)
-		else if (argv[1][0] == '-')
+		else if (neg1)
 		{
-			if (compare_list(head1, head2) > 0)
+			if (compare_list(num1, num2) > 0)
 				*sign_flag = -1;
 			return '-';
 		}
 		// a + (-b) → subtraction (sign depends on larger number)
-		else if (argv[3][0] == '-')
+		else if (neg2)
 		{
-			if (compare_list(head1, head2) < 0)
+			if (compare_list(num1, num2) < 0)
 				*sign_flag = -1;
 			return '-';
 		}
@@ -129,106 +274,129 @@ char check_operation_type(char **argv, Dlist *head1, Dlist *head2, int *sign_fla
 	}
 
 	// Case: Subtraction
-	else if (argv[2][0] == '-')
+	else if (operator == '-')
 	{
 		// (-a) - (-b) → compare and decide sign
-		if (argv[1][0] == '-' && argv[3][0] == '-')
+		if (neg1 && neg2)
 		{
-			if (compare_list(head1, head2) > 0)
+			if (compare_list(num1, num2) > 0)
 				*sign_flag = -1;
 			return '-';
 		}
 		// (-a) - b → always negative
-		else if (argv[1][0] == '-')
+		else if (neg1)
 		{
 			*sign_flag = -1;
 			return '+';
 		}
 		// a - (-b) → becomes addition
-		else if (argv[3][0] == '-')
+		else if (neg2)
 		{
 			return '+';
 		}
 		// a - b → normal subtraction, but sign depends on comparison
 		else
 		{
-			if (compare_list(head1, head2) < 0)
+			if (compare_list(num1, num2) < 0)
 				*sign_flag = -1;
 			return '-';
 		}
 	}
 
-	// Case: Multiplication
-	else if (argv[2][0] == 'x')
+	// Case: Multiplication ('*' is the same operator as 'x')
+	else if (operator == 'x' || operator == '*')
 	{
 		// If exactly one operand is negative → result is negative
-		if ((argv[1][0] == '-' && argv[3][0] != '-') || (argv[1][0] != '-' && argv[3][0] == '-'))
+		if (neg1 != neg2)
 			*sign_flag = -1;
 		return 'x';
 	}
 
 	// Case: Division
-	else if (argv[2][0] == '/')
+	else if (operator == '/')
 	{
 		// Same sign logic as multiplication
-		if ((argv[1][0] == '-' && argv[3][0] != '-') || (argv[1][0] != '-' && argv[3][0] == '-'))
+		if (neg1 != neg2)
 			*sign_flag = -1;
 		return '/';
 	}
 
+	// Case: Divmod (sign_flag is the quotient's; the remainder follows the dividend)
+	else if (operator == 'd')
+	{
+		if (neg1 != neg2)
+			*sign_flag = -1;
+		return 'd';
+	}
+
 	// Case: Modulus
-	else if (argv[2][0] == '%')
+	else if (operator == '%')
 	{
 		// Modulus result sign depends only on dividend
-		if (argv[1][0] == '-')
+		if (neg1)
 			*sign_flag = -1;
 		return '%';
 	}
 
 	// Case: Power
-	else if (argv[2][0] == '^')
+	else if (operator == '^')
 	{
-		// Modulus result sign depends only on dividend
-		int len = strlen(argv[3]) - 1;
-		if (argv[1][0] == '-' && argv[3][len] % 2 != 0)
+		// Negative base with an odd exponent → negative result
+		if (neg1 && num2->tail && num2->tail->data % 2 != 0)
 			*sign_flag = -1;
 		return '^';
 	}
 
 	// Default case → return as-is
 	else
-		return argv[2][0];
+		return operator;
 }
 
 /*
  * Function: check_exponent
  * -----------------------
- * Checks whether the exponent provided is valid for computation.
+ * Checks whether a power can be computed: the exponent must not be
+ * negative and the result must stay within pow_max_digits digits.
  * 
  * Parameters:
- *  exp : string representation of the exponent
+ *  base : base of the power
+ *  exp  : exponent
  *
  * Returns:
  *  SUCCESS if exponent is valid,
- *  FAILURE if exponent is negative or too large.
+ *  FAILURE if exponent is negative or the result would be too large.
  *
  * Notes:
  *  - Negative exponents are not supported in this integer-only APC.
- *  - Exponents longer than 4 digits are considered too large for practical computation.
+ *  - The size check is bi_pow_fits(), so the command line, --batch
+ *    and libapc refuse exactly the same powers; the limit is set
+ *    with -DPOW_MAX_DIGITS=n or by assigning pow_max_digits.
  */
-int check_exponent(char * exp)
+int check_exponent(const Dnum *base, const Dnum *exp)
 {
     // Check for negative exponent
-	if(exp[0] == '-')
+	if (exp->sign < 0)
 	{
 		fprintf(stderr, "❌ ERROR: Negative exponent not supported !\n");
 		return FAILURE;
 	}
-    // Check for exponent length > 4 digits (arbitrary limit for performance)
-	if(strlen(exp) > 4)
+
+	// The limit is bi_pow_fits(), the same bound bi_pow() enforces
+	Bigint b, e;
+	bi_init(&b);
+	bi_init(&e);
+
+	int status = FAILURE;
+	if (bi_from_list(&b, base->head) == SUCCESS && bi_from_list(&e, exp->head) == SUCCESS)
 	{
-		fprintf(stderr, "❌ ERROR: Exponent too large to compute !\n");
-		return FAILURE;
+		if (bi_pow_fits(&b, &e))
+			status = SUCCESS;
+		else
+			fprintf(stderr, "❌ ERROR: Result would have about %.3g digits, the limit is %zu !\n",
+					bi_pow_digits(&b, &e), pow_max_digits);
 	}
-	return SUCCESS; // exponent is valid
-}
\ No newline at end of file
+
+	bi_free(&b);
+	bi_free(&e);
+	return status;
+}
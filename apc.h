@@ -3,18 +3,22 @@
  *  Description : Header file for the Arbitrary Precision Calculator (APC).
  *                Contains data structure definitions, macro constants,
  *                and function prototypes for performing arithmetic
- *                operations (+, -, *, /, %, ^) on large numbers
- *                using doubly linked lists.
+ *                operations (+, -, *, /, %, d, ^) on large numbers
+ *                using doubly linked lists. The arithmetic itself
+ *                runs on the Bigint limb arrays from bigint.h.
  *
  *                Functions:
- *                - validate_input_args()
- *                - digit_to_list()
+ *                - operand_open() / operand_close() / operand_radix()
+ *                - src_to_num()
  *                - addition()
  *                - subtraction()
  *                - multiplication()
+ *                - square()
+ *                - divmod()
  *                - division()
  *                - modulus()
- *                - power()
+ *                - power() / power_mod()
+ *                - batch_mod() / batch_eval()
  *                - print_list()
  *                - check_operation_type()
  *                - check_exponent()
@@ -42,13 +46,39 @@ typedef struct node
 	struct node *next;
 } Dlist;
 
+/* Number handle: digit list with cached length and sign */
+typedef struct
+{
+	Dlist *head;    // most significant digit
+	Dlist *tail;    // least significant digit
+	size_t len;     // number of digits in the list
+	int sign;       // 1 = positive, -1 = negative
+} Dnum;
+
+/* Operand text: the argument itself, a mapped file or a buffered stream */
+typedef struct
+{
+	const char *text;   // operand characters (not NUL terminated)
+	size_t len;         // number of characters
+	void *map;          // file mapping behind text, or NULL
+	size_t map_len;     // bytes mapped
+	char *buf;          // heap buffer behind text, or NULL
+} Dsrc;
+
+/* Buffered output writer, defined in output.h */
+typedef struct Dwriter Dwriter;
+
 /* Include the prototypes here */
 
-/* Input Validation*/
-int validate_input_args(char **argv);
+/* Operand text from a literal, "@path" for a file or "@-" for stdin */
+int operand_open(Dsrc *src, const char *arg);
+void operand_close(Dsrc *src);
+
+/* 10 for decimal text, 16 / 8 / 2 for a 0x / 0o / 0b prefix, 0 for a binary record */
+int operand_radix(const Dsrc *src);
 
-/* Store the operands into the list */
-void digit_to_list(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, char *argv[]);
+/* Validate and store a decimal operand (digits and sign) into a number handle */
+int src_to_num(Dnum *num, const Dsrc *src);
 
 /* Addition */
 int addition(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR);
@@ -59,22 +89,40 @@ int subtraction(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlis
 /* Multiplication */
 int multiplication(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR);
 
+/* Square */
+int square(Dlist **head1, Dlist **tail1, Dlist **headR, Dlist **tailR);
+
 /* Division */
 int division(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR);
 
+/* Quotient and remainder from one division */
+int divmod(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2,
+		   Dlist **headQ, Dlist **tailQ, Dlist **headR, Dlist **tailR);
+
 /* Modulus */
 int modulus(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR);
 
-/* power */
+/* power: a base of 10^j is answered by power_of_ten(), the rest by power() */
+int power_of_ten(const Dlist *head1, const Dlist *head2, size_t *zeros);
 int power(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR);
 
+/* Modular power: num1 ^ num2 mod num3 */
+int power_mod(const Dnum *num1, const Dnum *num2, const Dnum *num3, Dlist **headR, Dlist **tailR);
+
+/* Batch modulus against a fixed divisor, one dividend per input line */
+int batch_mod(const char *divisor, FILE *in, Dwriter *out, int base);
+
+/* Batch evaluation, one "<a> <op> <b>" operation per input line,
+ * spread over a pool of threads when threads > 1 */
+int batch_eval(FILE *in, Dwriter *out, int base, int threads);
+
 /* Print List */
 void print_list(Dlist *head);
 
 /* to check operation type and sign flag */
-char check_operation_type(char ** argv, Dlist *head1, Dlist *head2, int * sign_flag);
+char check_operation_type(char operator, const Dnum *num1, const Dnum *num2, int * sign_flag);
 
-/* To check valid exponent for power operation */
-int check_exponent(char * exp);
+/* To check valid exponent and result size for power operation */
+int check_exponent(const Dnum *base, const Dnum *exp);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,695 @@
+/***********************************************************************
+ *  File Name   : apcd.c
+ *  Description : Entry point of apcd, the calculation daemon of the
+ *                Arbitrary Precision Calculator (APC).
+ *                apcd listens on a Unix domain socket and evaluates one
+ *                calculator operation per request on a pool of worker
+ *                threads, so a service that cannot link libapc still
+ *                pays for the arithmetic only, not for starting a
+ *                process per operation.
+ *
+ *                Functions:
+ *                - main()
+ *                - serve_request() / eval_request()
+ *                - mod_get() / mod_put()
+ *                - queue_push() / queue_pop()
+ *                - worker_main() / worker_free()
+ *
+ *  Notes       :
+ *  - Protocol: every request and every response is a frame of a 4-byte
+ *    big-endian length followed by that many bytes of text. A request
+ *    holds one operation with the syntax of a --batch line,
+ *    "<a> <op> <b>" or "<base> ^ <exp> mod <modulus>"; the response is
+ *    "ok <result>" ("ok <quotient> <remainder>" for d) or
+ *    "error <message>". A connection may send any number of requests
+ *    and gets the responses back in the same order.
+ *  - The main thread polls the listening socket and the idle
+ *    connections, and queues a connection as soon as a request starts
+ *    to arrive. A worker reads that one request, answers it and hands
+ *    the connection back, so idle connections hold no thread.
+ *  - Caches stay warm for the life of the daemon: the powers of ten
+ *    used by decimal conversion, and contexts for the last
+ *    APCD_MOD_CACHE moduli used with % and modular powers, so a
+ *    repeated modulus costs multiplications instead of a division.
+ *  - Everything numeric goes through the libapc.h interface.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#define _GNU_SOURCE   // accept4(), pipe2()
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include "libapc.h"
+
+#define SUCCESS 0
+#define FAILURE -1
+
+#define APCD_MAX_REQUEST (64u << 20)   // largest request frame accepted
+#define APCD_MOD_CACHE   16            // modulus contexts kept warm
+#define APCD_IO_TIMEOUT  10            // seconds a started frame may stall
+#define APCD_BACKLOG     128
+
+/* Requests apcd rejects before they reach libapc */
+#define APCD_ESYNTAX (-100)   // not the shape of an operation
+#define APCD_ETOOBIG (-101)   // frame above APCD_MAX_REQUEST
+
+/* A cached modulus context, shared by the workers using it */
+typedef struct
+{
+	apc_num *m;              // the modulus as given in the request
+	apc_modulus *ctx;
+	unsigned refs;           // workers using it, plus one while cached
+	unsigned long stamp;     // last use, for eviction
+} Mentry;
+
+/* One worker thread and what it keeps between requests */
+typedef struct
+{
+	pthread_t id;
+	apc_num *x[3], *r, *rem;
+	char *req;               // request text, NUL terminated
+	size_t req_cap;
+	char *res;               // response frame: length, then text
+	size_t res_cap;
+} Worker;
+
+/* Connections waiting for a worker, in arrival order */
+static struct
+{
+	pthread_mutex_t lock;
+	pthread_cond_t ready;
+	int *fd;
+	size_t head, count, cap;
+} queue = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, 0, 0, 0 };
+
+static Mentry *mod_cache[APCD_MOD_CACHE];
+static unsigned long mod_clock;
+static pthread_mutex_t mod_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int out_base = 10;          // --base
+static int wake_fd[2];             // workers hand connections back here
+static volatile sig_atomic_t quit;
+
+static void on_signal(int sig)
+{
+	(void)sig;
+	quit = 1;
+}
+
+/*
+ * Grows a byte buffer to at least n bytes.
+ */
+static int reserve(char **buf, size_t *cap, size_t n)
+{
+	if (n <= *cap)
+		return SUCCESS;
+
+	size_t c = *cap ? *cap : 4096;
+	while (c < n)
+		c *= 2;
+	char *p = realloc(*buf, c);
+	if (p == NULL)
+		return FAILURE;
+	*buf = p;
+	*cap = c;
+	return SUCCESS;
+}
+
+/*
+ * Appends a connection to the queue and wakes one worker.
+ */
+static int queue_push(int fd)
+{
+	pthread_mutex_lock(&queue.lock);
+	if (queue.count == queue.cap)
+	{
+		size_t cap = queue.cap ? 2 * queue.cap : 64;
+		int *p = malloc(cap * sizeof(int));
+		if (p == NULL)
+		{
+			pthread_mutex_unlock(&queue.lock);
+			return FAILURE;
+		}
+		for (size_t i = 0; i < queue.count; i++)
+			p[i] = queue.fd[(queue.head + i) % queue.cap];
+		free(queue.fd);
+		queue.fd = p;
+		queue.head = 0;
+		queue.cap = cap;
+	}
+	queue.fd[(queue.head + queue.count++) % queue.cap] = fd;
+	pthread_cond_signal(&queue.ready);
+	pthread_mutex_unlock(&queue.lock);
+	return SUCCESS;
+}
+
+/*
+ * Takes the oldest queued connection, waiting for one if needed.
+ */
+static int queue_pop(void)
+{
+	pthread_mutex_lock(&queue.lock);
+	while (queue.count == 0)
+		pthread_cond_wait(&queue.ready, &queue.lock);
+	int fd = queue.fd[queue.head];
+	queue.head = (queue.head + 1) % queue.cap;
+	queue.count--;
+	pthread_mutex_unlock(&queue.lock);
+	return fd;
+}
+
+/*
+ * Frees a modulus cache entry.
+ */
+static void mod_drop(Mentry *e)
+{
+	apc_free(e->m);
+	apc_modulus_free(e->ctx);
+	free(e);
+}
+
+/*
+ * Function: mod_get
+ * -----------------
+ * Finds the context for modulus m in the cache, or builds it and
+ * caches it in place of the least recently used entry. The context is
+ * built outside the lock; two workers racing on the same new modulus
+ * may both cache it, and the spare copy simply ages out.
+ * Release the entry with mod_put().
+ *
+ * Returns:
+ *  APC_OK, APC_EDIVZERO for a zero modulus, or APC_ENOMEM.
+ */
+static int mod_get(Mentry **out, const apc_num *m)
+{
+	pthread_mutex_lock(&mod_lock);
+	for (int i = 0; i < APCD_MOD_CACHE; i++)
+		if (mod_cache[i] && apc_cmp(mod_cache[i]->m, m) == 0)
+		{
+			*out = mod_cache[i];
+			(*out)->refs++;
+			(*out)->stamp = ++mod_clock;
+			pthread_mutex_unlock(&mod_lock);
+			return APC_OK;
+		}
+	pthread_mutex_unlock(&mod_lock);
+
+	Mentry *e = calloc(1, sizeof(Mentry));
+	if (e == NULL)
+		return APC_ENOMEM;
+	int rc = (e->m = apc_new()) ? apc_copy(e->m, m) : APC_ENOMEM;
+	if (rc == APC_OK)
+		rc = apc_modulus_new(&e->ctx, m);
+	if (rc != APC_OK)
+	{
+		mod_drop(e);
+		return rc;
+	}
+	e->refs = 2;   // the caller and the cache
+
+	// An empty slot, or else the least recently used one
+	pthread_mutex_lock(&mod_lock);
+	int slot = 0;
+	for (int i = 0; i < APCD_MOD_CACHE; i++)
+	{
+		if (mod_cache[i] == NULL)
+		{
+			slot = i;
+			break;
+		}
+		if (mod_cache[i]->stamp < mod_cache[slot]->stamp)
+			slot = i;
+	}
+	Mentry *old = mod_cache[slot];
+	if (old && --old->refs > 0)
+		old = NULL;   // still in use: its last user frees it
+	mod_cache[slot] = e;
+	e->stamp = ++mod_clock;
+	pthread_mutex_unlock(&mod_lock);
+
+	if (old)
+		mod_drop(old);
+	*out = e;
+	return APC_OK;
+}
+
+/*
+ * Releases an entry taken with mod_get().
+ */
+static void mod_put(Mentry *e)
+{
+	pthread_mutex_lock(&mod_lock);
+	unsigned refs = --e->refs;
+	pthread_mutex_unlock(&mod_lock);
+
+	if (refs == 0)
+		mod_drop(e);
+}
+
+/*
+ * Reads exactly n bytes.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on an error, a timeout or the end of the stream.
+ */
+static int read_full(int fd, void *buf, size_t n)
+{
+	for (char *p = buf; n > 0;)
+	{
+		ssize_t k = read(fd, p, n);
+		if (k < 0 && errno == EINTR)
+			continue;
+		if (k <= 0)
+			return FAILURE;
+		p += k;
+		n -= k;
+	}
+	return SUCCESS;
+}
+
+/*
+ * Writes exactly n bytes; a peer that went away is an error, not a
+ * signal.
+ */
+static int write_full(int fd, const void *buf, size_t n)
+{
+	for (const char *p = buf; n > 0;)
+	{
+		ssize_t k = send(fd, p, n, MSG_NOSIGNAL);
+		if (k < 0 && errno == EINTR)
+			continue;
+		if (k <= 0)
+			return FAILURE;
+		p += k;
+		n -= k;
+	}
+	return SUCCESS;
+}
+
+/*
+ * Splits a string in place into blank separated words.
+ *
+ * Returns:
+ *  The number of words found, at most max of them stored.
+ */
+static int split_words(char *s, char **word, int max)
+{
+	int n = 0;
+
+	for (char *p = s; *p;)
+	{
+		while (isspace((unsigned char)*p))
+			*p++ = '\0';
+		if (*p == '\0')
+			break;
+		if (n < max)
+			word[n] = p;
+		n++;
+		while (*p && !isspace((unsigned char)*p))
+			p++;
+	}
+	return n;
+}
+
+/*
+ * Appends n bytes to the response text after the length field.
+ */
+static int res_append(Worker *w, size_t *len, const char *s, size_t n)
+{
+	if (reserve(&w->res, &w->res_cap, 4 + *len + n) == FAILURE)
+		return APC_ENOMEM;
+	memcpy(w->res + 4 + *len, s, n);
+	*len += n;
+	return APC_OK;
+}
+
+/*
+ * Appends a number in the output base to the response text.
+ */
+static int res_number(Worker *w, size_t *len, const apc_num *n)
+{
+	size_t size = apc_format_size(n, out_base), k;
+	if (reserve(&w->res, &w->res_cap, 4 + *len + size) == FAILURE)
+		return APC_ENOMEM;
+
+	int rc = apc_format(n, out_base, w->res + 4 + *len, size, &k);
+	if (rc == APC_OK)
+		*len += k;
+	return rc;
+}
+
+/*
+ * Function: eval_request
+ * ----------------------
+ * Evaluates the operation in a request and writes "ok ..." to the
+ * response text, with *len its length.
+ *
+ * Returns:
+ *  APC_OK, APCD_ESYNTAX for a request that is not an operation, or the
+ *  libapc error code of the operation.
+ */
+static int eval_request(Worker *w, char *text, size_t *len)
+{
+	// <a> <op> <b>, or <base> ^ <exponent> mod <modulus>
+	char *tok[5];
+	int n = split_words(text, tok, 5);
+	int modpow = n == 5 && strcmp(tok[1], "^") == 0 && strcmp(tok[3], "mod") == 0;
+	if ((n != 3 && !modpow) || tok[1][1] != '\0')
+		return APCD_ESYNTAX;
+
+	int rc = APC_OK;
+	for (int i = 0; i < (modpow ? 3 : 2) && rc == APC_OK; i++)
+		rc = apc_parse(w->x[i], tok[2 * i], strlen(tok[2 * i]));
+	if (rc != APC_OK)
+		return rc;
+
+	char op = tok[1][0];
+	Mentry *e = NULL;
+	switch (op)
+	{
+		case '+':
+			rc = apc_add(w->r, w->x[0], w->x[1]);
+			break;
+		case '-':
+			rc = apc_sub(w->r, w->x[0], w->x[1]);
+			break;
+		case 'x':
+		case '*':
+			rc = apc_mul(w->r, w->x[0], w->x[1]);
+			break;
+		case '/':
+			rc = apc_div(w->r, w->x[0], w->x[1]);
+			break;
+		case 'd':
+			rc = apc_divmod(w->r, w->rem, w->x[0], w->x[1]);
+			break;
+		case '%':
+			if ((rc = mod_get(&e, w->x[1])) == APC_OK)
+				rc = apc_reduce(w->r, w->x[0], e->ctx);
+			break;
+		case '^':
+			if (!modpow)
+				rc = apc_pow(w->r, w->x[0], w->x[1]);
+			else if ((rc = mod_get(&e, w->x[2])) == APC_OK)
+				rc = apc_powmod_ctx(w->r, w->x[0], w->x[1], e->ctx);
+			break;
+		default:
+			return APCD_ESYNTAX;
+	}
+	if (e)
+		mod_put(e);
+	if (rc != APC_OK)
+		return rc;
+
+	*len = 0;
+	rc = res_append(w, len, "ok ", 3);
+	if (rc == APC_OK)
+		rc = res_number(w, len, w->r);
+	if (rc == APC_OK && op == 'd' && (rc = res_append(w, len, " ", 1)) == APC_OK)
+		rc = res_number(w, len, w->rem);
+	return rc;
+}
+
+/*
+ * Function: serve_request
+ * -----------------------
+ * Reads one request frame from a connection and writes its response.
+ *
+ * Returns:
+ *  SUCCESS if the connection can take another request, FAILURE if it
+ *  was closed, stalled, broke the framing or cannot be answered.
+ */
+static int serve_request(Worker *w, int fd)
+{
+	unsigned char h[4];
+	if (read_full(fd, h, 4) == FAILURE)
+		return FAILURE;
+
+	uint32_t n = (uint32_t)h[0] << 24 | (uint32_t)h[1] << 16 | (uint32_t)h[2] << 8 | h[3];
+	int rc = APC_OK, keep = SUCCESS;
+	if (n > APCD_MAX_REQUEST)
+	{
+		// The rest of the frame is not read, so the stream is lost
+		rc = APCD_ETOOBIG;
+		keep = FAILURE;
+	}
+	else if (reserve(&w->req, &w->req_cap, (size_t)n + 1) == FAILURE)
+		return FAILURE;
+	else if (read_full(fd, w->req, n) == FAILURE)
+		return FAILURE;
+
+	size_t len = 0;
+	if (rc == APC_OK)
+	{
+		w->req[n] = '\0';
+		rc = memchr(w->req, '\0', n) ? APCD_ESYNTAX : eval_request(w, w->req, &len);
+	}
+	if (rc != APC_OK)
+	{
+		const char *msg = rc == APCD_ESYNTAX ? "malformed request" :
+			rc == APCD_ETOOBIG ? "request too large" : apc_strerror(rc);
+		len = 0;
+		if (res_append(w, &len, "error ", 6) != APC_OK || res_append(w, &len, msg, strlen(msg)) != APC_OK)
+			return FAILURE;
+	}
+
+	w->res[0] = (unsigned char)(len >> 24);
+	w->res[1] = (unsigned char)(len >> 16);
+	w->res[2] = (unsigned char)(len >> 8);
+	w->res[3] = (unsigned char)len;
+	if (write_full(fd, w->res, 4 + len) == FAILURE)
+		return FAILURE;
+	return keep;
+}
+
+/*
+ * Worker thread: serves one request per queued connection, then hands
+ * the connection back to the main thread's poll set.
+ */
+static void *worker_main(void *arg)
+{
+	Worker *w = arg;
+
+	for (;;)
+	{
+		int fd = queue_pop();
+		if (serve_request(w, fd) == SUCCESS && write(wake_fd[1], &fd, sizeof fd) == sizeof fd)
+			continue;
+		close(fd);
+	}
+	return NULL;
+}
+
+/*
+ * Releases the numbers of a worker whose thread did not start (any of
+ * them may still be NULL).
+ */
+static void worker_free(Worker *w)
+{
+	for (int k = 0; k < 3; k++)
+		apc_free(w->x[k]);
+	apc_free(w->r);
+	apc_free(w->rem);
+}
+
+/*
+ * Adds a descriptor to the poll set, growing it as needed.
+ */
+static int poll_add(struct pollfd **pfd, size_t *n, size_t *cap, int fd)
+{
+	if (*n == *cap)
+	{
+		size_t c = *cap ? 2 * *cap : 64;
+		struct pollfd *p = realloc(*pfd, c * sizeof(struct pollfd));
+		if (p == NULL)
+			return FAILURE;
+		*pfd = p;
+		*cap = c;
+	}
+	(*pfd)[*n].fd = fd;
+	(*pfd)[*n].events = POLLIN;
+	(*pfd)[*n].revents = 0;
+	(*n)++;
+	return SUCCESS;
+}
+
+/*
+ * Binds and listens on a Unix socket at path. A socket file left over
+ * from an earlier run is replaced; any other file is left alone.
+ */
+static int open_listener(const char *path)
+{
+	struct sockaddr_un addr;
+	if (strlen(path) >= sizeof addr.sun_path)
+	{
+		fprintf(stderr, "❌ ERROR: Socket path too long\n");
+		return -1;
+	}
+	memset(&addr, 0, sizeof addr);
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+
+	struct stat st;
+	if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof addr) < 0 || listen(fd, APCD_BACKLOG) < 0)
+	{
+		fprintf(stderr, "❌ ERROR: Cannot listen on '%s': %s\n", path, strerror(errno));
+		if (fd >= 0)
+			close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+int main(int argc, char **argv)
+{
+	int threads = 0;
+
+	/* Options: --threads <n> sizes the worker pool, --base <b> picks
+	 * the base results are written in */
+	int i = 1;
+	for (; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "--threads") == 0)
+			threads = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "--base") == 0)
+			out_base = atoi(argv[i + 1]);
+		else
+			break;
+	}
+	if (i != argc - 1 || threads < 0 || (out_base != 10 && out_base != 16 && out_base != 8 && out_base != 2))
+	{
+		fprintf(stderr, "Usage: %s [--threads <n>] [--base 10|16|8|2] <socket path>\n", argv[0]);
+		return FAILURE;
+	}
+	const char *path = argv[i];
+	if (threads == 0)
+	{
+		long cores = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = cores > 0 ? (int)cores : 1;
+	}
+
+	/* SIGINT / SIGTERM stop the poll loop; no SA_RESTART, so poll()
+	 * returns to notice */
+	struct sigaction sa;
+	memset(&sa, 0, sizeof sa);
+	sa.sa_handler = on_signal;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	signal(SIGPIPE, SIG_IGN);
+
+	int lfd = open_listener(path);
+	if (lfd < 0)
+		return FAILURE;
+	if (pipe2(wake_fd, O_CLOEXEC) < 0)
+	{
+		fprintf(stderr, "❌ ERROR: Cannot create pipe: %s\n", strerror(errno));
+		close(lfd);
+		unlink(path);
+		return FAILURE;
+	}
+
+	/* Workers keep their numbers and buffers for the life of the daemon */
+	Worker *pool = calloc(threads, sizeof(Worker));
+	int started = 0;
+	for (; pool && started < threads; started++)
+	{
+		Worker *w = &pool[started];
+		int ok = 1;
+		for (int k = 0; k < 3; k++)
+			ok = ok && (w->x[k] = apc_new()) != NULL;
+		ok = ok && (w->r = apc_new()) != NULL && (w->rem = apc_new()) != NULL;
+		if (!ok || pthread_create(&w->id, NULL, worker_main, w) != 0)
+		{
+			worker_free(w);
+			break;
+		}
+	}
+	if (started == 0)
+	{
+		fprintf(stderr, "❌ ERROR: Cannot start worker threads\n");
+		free(pool);
+		close(wake_fd[0]);
+		close(wake_fd[1]);
+		close(lfd);
+		unlink(path);
+		return FAILURE;
+	}
+
+	struct pollfd *pfd = NULL;
+	size_t npfd = 0, cap = 0;
+	int status = SUCCESS;
+	if (poll_add(&pfd, &npfd, &cap, lfd) == FAILURE || poll_add(&pfd, &npfd, &cap, wake_fd[0]) == FAILURE)
+		status = FAILURE;
+
+	while (status == SUCCESS && !quit)
+	{
+		if (poll(pfd, npfd, -1) < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			fprintf(stderr, "❌ ERROR: poll: %s\n", strerror(errno));
+			status = FAILURE;
+			break;
+		}
+
+		// A request is arriving on these: queue them for the workers
+		for (size_t k = npfd; k-- > 2;)
+		{
+			if (pfd[k].revents == 0)
+				continue;
+			int fd = pfd[k].fd;
+			pfd[k] = pfd[--npfd];
+			if (queue_push(fd) == FAILURE)
+				close(fd);
+		}
+
+		// Connections the workers are done with
+		if (pfd[1].revents & POLLIN)
+		{
+			int back[256];
+			ssize_t got = read(wake_fd[0], back, sizeof back);
+			for (ssize_t k = 0; k < got / (ssize_t)sizeof(int); k++)
+				if (poll_add(&pfd, &npfd, &cap, back[k]) == FAILURE)
+					close(back[k]);
+		}
+
+		// New connections; a stalled client cannot hold a worker for long
+		if (pfd[0].revents & POLLIN)
+		{
+			int fd = accept4(lfd, NULL, NULL, SOCK_CLOEXEC);
+			if (fd >= 0)
+			{
+				struct timeval tv = { APCD_IO_TIMEOUT, 0 };
+				setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
+				setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof tv);
+				if (poll_add(&pfd, &npfd, &cap, fd) == FAILURE)
+					close(fd);
+			}
+		}
+	}
+
+	/* Workers may be mid-request; the process exit ends them */
+	close(lfd);
+	unlink(path);
+	free(pfd);
+	return status;
+}
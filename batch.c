@@ -0,0 +1,526 @@
+/***********************************************************************
+ *  File Name   : batch.c
+ *  Description : Source file for the batch modes of the Arbitrary
+ *                Precision Calculator (APC).
+ *                A batch reads many operands in one run and prints one
+ *                result per line, so work that depends only on the
+ *                fixed operand is done once for the whole batch, and
+ *                process startup is paid once instead of per operation.
+ *
+ *                Functions:
+ *                - batch_mod()
+ *                - batch_eval()
+ *
+ *  Notes       :
+ *  - A parallel batch_eval() reads the input in chunks of lines, which
+ *    a pool of worker threads evaluates into per-chunk result buffers.
+ *    The chunks live in a ring of slots that doubles as the reorder
+ *    buffer: the main thread writes slot after slot in input order, and
+ *    refills a slot only once its results have gone out.
+ *  - Each worker owns its operand and result Bigints and its own output
+ *    buffer for the whole batch, so after the first few lines workers
+ *    only allocate the scratch of the arithmetic itself.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <pthread.h>
+#include "apc.h"
+#include "bigint.h"
+#include "output.h"
+
+#define BATCH_CHUNK_LINES 256     // lines handed to a worker at a time,
+#define BATCH_CHUNK_BYTES 16384   // or this much input, whichever is first
+#define BATCH_SLOTS       4       // chunks in flight per worker
+
+/* Operands and results of one evaluator, reused from line to line */
+typedef struct
+{
+	Bigint x[3];
+	Bigint r, rem;
+} Beval;
+
+enum { SLOT_FREE, SLOT_READY, SLOT_DONE };
+
+/* One chunk of input lines and the text of their results */
+typedef struct
+{
+	int state;          // SLOT_FREE, SLOT_READY or SLOT_DONE
+	char *text;         // input lines, each '\n' terminated
+	size_t len, cap;
+	size_t first;       // line number of the first line
+	FILE *mem;          // memory stream the results are written to
+	char *res;          // results, as last flushed to mem
+	size_t res_len;
+	int status;         // SUCCESS, or FAILURE at the last result line
+} Bslot;
+
+/* State shared by the main thread and the workers */
+typedef struct
+{
+	pthread_mutex_t lock;
+	pthread_cond_t ready;   // a slot was filled, or the input ended
+	pthread_cond_t done;    // a slot was evaluated
+	Bslot *slot;
+	size_t nslots;
+	size_t filled;          // chunks filled so far
+	size_t next;            // sequence number of the next chunk to evaluate
+	size_t stop;            // first chunk that failed, SIZE_MAX if none
+	int eof;                // no more chunks will be filled
+	int base;               // output base
+} Bpool;
+
+/* One worker thread and what it keeps between chunks */
+typedef struct
+{
+	pthread_t id;
+	Bpool *pool;
+	Beval eval;
+	Dwriter *out;
+} Bworker;
+
+/*
+ * Strips trailing newline and blank characters from a line in place.
+ */
+static void trim_line(char *line, ssize_t len)
+{
+	while (len > 0 && isspace((unsigned char)line[len - 1]))
+		line[--len] = '\0';
+}
+
+/*
+ * Function: batch_mod
+ * -------------------
+ * Reduces every dividend read from in (one decimal number per line)
+ * modulo a fixed divisor and writes each remainder on its own line.
+ * The divisor is turned into a modulus context once, so each line
+ * costs a Barrett reduction instead of a long division. Remainders
+ * take the sign of the dividend, as with the '%' operator.
+ *
+ * Parameters:
+ *  divisor : decimal string of the fixed divisor
+ *  in      : stream of dividends
+ *  out     : writer the remainders go to
+ *  base    : output base, 10, 16, 8 or 2
+ *
+ * Returns:
+ *  SUCCESS if every line was reduced,
+ *  FAILURE on an invalid operand, a zero divisor or allocation failure.
+ */
+int batch_mod(const char *divisor, FILE *in, Dwriter *out, int base)
+{
+	Bigint m, a;
+	Bimod ctx;
+	int status = SUCCESS;
+	bi_init(&m);
+	bi_init(&a);
+
+	/* The divisor may hold limbs even when rejected, so every failure
+	 * here frees it */
+	if (bi_from_str(&m, divisor) == FAILURE)
+	{
+		fprintf(stderr, "❌ Error: Invalid Operand :-( Try again...\n");
+		status = FAILURE;
+	}
+	else if (m.len == 0)
+	{
+		fprintf(stderr, "❌ ERROR: Modulo by zero !\n");
+		status = FAILURE;
+	}
+	else if (bi_mod_init(&ctx, &m) == FAILURE)
+		status = FAILURE;
+	if (status == FAILURE)
+	{
+		bi_free(&m);
+		return FAILURE;
+	}
+
+	char *line = NULL;
+	size_t cap = 0;
+	ssize_t len;
+	size_t lineno = 0;
+
+	while (status == SUCCESS && (len = getline(&line, &cap, in)) != -1)
+	{
+		lineno++;
+		trim_line(line, len);
+		if (line[0] == '\0')
+			continue;
+
+		if (bi_from_str(&a, line) == FAILURE)
+		{
+			fprintf(stderr, "❌ Error: Invalid Operand on line %zu :-( Try again...\n", lineno);
+			status = FAILURE;
+		}
+		else if (bi_mod_reduce(&a, &a, &ctx) == FAILURE || dw_bigint_base(out, &a, base) == FAILURE ||
+			dw_str(out, "\n") == FAILURE)
+			status = FAILURE;
+	}
+
+	free(line);
+	bi_mod_free(&ctx);
+	bi_free(&m);
+	bi_free(&a);
+	return status;
+}
+
+/*
+ * Splits a line in place into blank separated tokens.
+ *
+ * Returns:
+ *  The number of tokens found, at most max (further tokens are
+ *  counted but not stored).
+ */
+static int split_line(char *line, char **tok, int max)
+{
+	int n = 0;
+
+	for (char *p = line; *p;)
+	{
+		while (isspace((unsigned char)*p))
+			*p++ = '\0';
+		if (*p == '\0')
+			break;
+		if (n < max)
+			tok[n] = p;
+		n++;
+		while (*p && !isspace((unsigned char)*p))
+			p++;
+	}
+	return n;
+}
+
+static void beval_init(Beval *e)
+{
+	for (int i = 0; i < 3; i++)
+		bi_init(&e->x[i]);
+	bi_init(&e->r);
+	bi_init(&e->rem);
+}
+
+static void beval_free(Beval *e)
+{
+	for (int i = 0; i < 3; i++)
+		bi_free(&e->x[i]);
+	bi_free(&e->r);
+	bi_free(&e->rem);
+}
+
+/*
+ * Evaluates one "<a> <op> <b>" or "<base> ^ <exp> mod <modulus>" line
+ * and writes its result line. Blank lines produce nothing.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE (reported with the line number) if the line
+ *  cannot be evaluated.
+ */
+static int eval_line(Beval *e, char *line, size_t lineno, Dwriter *out, int base)
+{
+	char *tok[5];
+	int n = split_line(line, tok, 5);
+	if (n == 0)
+		return SUCCESS;
+
+	// <a> <op> <b>, or <base> ^ <exponent> mod <modulus>
+	int modpow = n == 5 && strcmp(tok[1], "^") == 0 && strcmp(tok[3], "mod") == 0;
+	if ((n != 3 && !modpow) || tok[1][1] != '\0')
+	{
+		fprintf(stderr, "❌ Error: Invalid Syntax on line %zu :-( Try again...\n", lineno);
+		return FAILURE;
+	}
+	if (bi_from_str(&e->x[0], tok[0]) == FAILURE || bi_from_str(&e->x[1], tok[2]) == FAILURE ||
+		(modpow && bi_from_str(&e->x[2], tok[4]) == FAILURE))
+	{
+		fprintf(stderr, "❌ Error: Invalid Operand on line %zu :-( Try again...\n", lineno);
+		return FAILURE;
+	}
+
+	// A power of ten in decimal is written as a one and zeroes, never built
+	size_t zeros;
+	int sign;
+	if (tok[1][0] == '^' && !modpow && base == 10 && bi_pow10_zeros(&e->x[0], &e->x[1], &zeros, &sign))
+	{
+		if ((sign < 0 && dw_str(out, "-") == FAILURE) || dw_pow10(out, zeros) == FAILURE)
+			return FAILURE;
+		return dw_str(out, "\n");
+	}
+
+	if (bi_eval(&e->r, &e->rem, tok[1][0], &e->x[0], &e->x[1], modpow ? &e->x[2] : NULL) == FAILURE)
+	{
+		fprintf(stderr, "❌ Error: Evaluation stopped on line %zu\n", lineno);
+		return FAILURE;
+	}
+
+	if (dw_bigint_base(out, &e->r, base) == FAILURE ||
+		(tok[1][0] == 'd' && (dw_str(out, " ") == FAILURE || dw_bigint_base(out, &e->rem, base) == FAILURE)))
+		return FAILURE;
+	return dw_str(out, "\n");
+}
+
+/*
+ * Evaluates every line of a chunk into the slot's memory stream,
+ * stopping at the first line that fails.
+ */
+static int eval_chunk(Bworker *wk, Bslot *s)
+{
+	int status = SUCCESS;
+	size_t lineno = s->first;
+
+	rewind(s->mem);
+	dw_init(wk->out, s->mem);
+	for (char *line = s->text, *end = s->text + s->len; status == SUCCESS && line < end; lineno++)
+	{
+		char *nl = memchr(line, '\n', end - line);
+		*nl = '\0';
+		status = eval_line(&wk->eval, line, lineno, wk->out, wk->pool->base);
+		line = nl + 1;
+	}
+
+	// Flushing publishes the results in s->res / s->res_len
+	if (dw_flush(wk->out) == FAILURE)
+		status = FAILURE;
+	return status;
+}
+
+/*
+ * Worker thread: takes filled chunks in input order until the input
+ * ends. Chunks after one that failed are skipped, as their results
+ * would never be written.
+ */
+static void *batch_worker(void *arg)
+{
+	Bworker *wk = arg;
+	Bpool *pool = wk->pool;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;)
+	{
+		while (pool->next == pool->filled && !pool->eof)
+			pthread_cond_wait(&pool->ready, &pool->lock);
+		if (pool->next == pool->filled)
+			break;
+
+		size_t seq = pool->next++;
+		Bslot *s = &pool->slot[seq % pool->nslots];
+		int skip = seq > pool->stop;
+		pthread_mutex_unlock(&pool->lock);
+
+		s->status = skip ? FAILURE : eval_chunk(wk, s);
+
+		pthread_mutex_lock(&pool->lock);
+		if (s->status == FAILURE && seq < pool->stop)
+			pool->stop = seq;
+		s->state = SLOT_DONE;
+		pthread_cond_signal(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return NULL;
+}
+
+/*
+ * Reads up to one chunk of lines into a slot.
+ *
+ * Returns:
+ *  The number of lines read (0 at the end of the input),
+ *  or -1 on allocation failure.
+ */
+static long fill_chunk(Bslot *s, FILE *in, char **line, size_t *cap, size_t first)
+{
+	ssize_t len;
+	long n = 0;
+
+	s->len = 0;
+	s->first = first;
+	while (n < BATCH_CHUNK_LINES && s->len < BATCH_CHUNK_BYTES && (len = getline(line, cap, in)) != -1)
+	{
+		// Room for the line and a '\n' if it lacks one
+		if (s->len + len + 1 > s->cap)
+		{
+			size_t ncap = s->cap ? s->cap : BATCH_CHUNK_BYTES;
+			while (ncap < s->len + len + 1)
+				ncap *= 2;
+			char *text = realloc(s->text, ncap);
+			if (text == NULL)
+				return -1;
+			s->text = text;
+			s->cap = ncap;
+		}
+		memcpy(s->text + s->len, *line, len);
+		s->len += len;
+		if (len == 0 || (*line)[len - 1] != '\n')
+			s->text[s->len++] = '\n';
+		n++;
+	}
+	return n;
+}
+
+/*
+ * Evaluates the batch with a pool of worker threads (see Notes). The
+ * main thread reads chunks into free slots and writes evaluated ones
+ * in order, waiting only when it can do neither.
+ */
+static int batch_eval_pool(FILE *in, Dwriter *out, int base, int threads)
+{
+	Bpool pool;
+	pool.nslots = (size_t)threads * BATCH_SLOTS;
+	pool.filled = pool.next = 0;
+	pool.stop = SIZE_MAX;
+	pool.eof = 0;
+	pool.base = base;
+	pool.slot = calloc(pool.nslots, sizeof(Bslot));
+	Bworker *wk = calloc(threads, sizeof(Bworker));
+	if (pool.slot == NULL || wk == NULL)
+	{
+		free(pool.slot);
+		free(wk);
+		return FAILURE;
+	}
+	pthread_mutex_init(&pool.lock, NULL);
+	pthread_cond_init(&pool.ready, NULL);
+	pthread_cond_init(&pool.done, NULL);
+
+	int status = SUCCESS;
+	for (size_t i = 0; i < pool.nslots; i++)
+		if ((pool.slot[i].mem = open_memstream(&pool.slot[i].res, &pool.slot[i].res_len)) == NULL)
+			status = FAILURE;
+
+	int started = 0;
+	while (status == SUCCESS && started < threads)
+	{
+		wk[started].pool = &pool;
+		beval_init(&wk[started].eval);
+		if ((wk[started].out = malloc(sizeof(Dwriter))) == NULL)
+			status = FAILURE;
+		else if (pthread_create(&wk[started].id, NULL, batch_worker, &wk[started]) != 0)
+		{
+			free(wk[started].out);
+			status = FAILURE;
+		}
+		else
+			started++;
+	}
+	if (started == 0)
+		status = FAILURE;
+
+	char *line = NULL;
+	size_t cap = 0, lineno = 0, written = 0;
+	int more = 1;   // input not exhausted yet
+
+	pthread_mutex_lock(&pool.lock);
+	while (status == SUCCESS)
+	{
+		// Write the oldest chunk once it is evaluated
+		Bslot *s = &pool.slot[written % pool.nslots];
+		if (written < pool.filled && s->state == SLOT_DONE)
+		{
+			pthread_mutex_unlock(&pool.lock);
+			if (dw_bytes(out, s->res, s->res_len) == FAILURE || s->status == FAILURE)
+				status = FAILURE;
+			pthread_mutex_lock(&pool.lock);
+			s->state = SLOT_FREE;
+			written++;
+			continue;
+		}
+
+		// Otherwise refill a free slot while the ring has one
+		if (more && pool.filled - written < pool.nslots)
+		{
+			Bslot *f = &pool.slot[pool.filled % pool.nslots];
+			pthread_mutex_unlock(&pool.lock);
+			long n = fill_chunk(f, in, &line, &cap, lineno + 1);
+			pthread_mutex_lock(&pool.lock);
+
+			if (n < 0)
+				status = FAILURE;
+			else if (n == 0)
+				more = 0;
+			else
+			{
+				lineno += n;
+				f->state = SLOT_READY;
+				pool.filled++;
+				pthread_cond_signal(&pool.ready);
+			}
+			continue;
+		}
+
+		if (!more && written == pool.filled)
+			break;
+		pthread_cond_wait(&pool.done, &pool.lock);
+	}
+
+	// Release the workers: no more chunks, and skip any still queued
+	pool.eof = 1;
+	if (status == FAILURE)
+		pool.stop = 0;
+	pthread_cond_broadcast(&pool.ready);
+	pthread_mutex_unlock(&pool.lock);
+
+	for (int i = 0; i < started; i++)
+	{
+		pthread_join(wk[i].id, NULL);
+		beval_free(&wk[i].eval);
+		free(wk[i].out);
+	}
+	for (size_t i = 0; i < pool.nslots; i++)
+	{
+		if (pool.slot[i].mem)
+			fclose(pool.slot[i].mem);
+		free(pool.slot[i].res);
+		free(pool.slot[i].text);
+	}
+	pthread_cond_destroy(&pool.done);
+	pthread_cond_destroy(&pool.ready);
+	pthread_mutex_destroy(&pool.lock);
+	free(pool.slot);
+	free(wk);
+	free(line);
+	return status;
+}
+
+/*
+ * Function: batch_eval
+ * --------------------
+ * Evaluates one operation per line read from in and writes each result
+ * on its own line, with no framing. A line is "<a> <op> <b>", or
+ * "<base> ^ <exponent> mod <modulus>", with the operands and operators
+ * of the command line; divmod writes "<quotient> <remainder>".
+ *
+ * With more than one thread the lines are evaluated by a worker pool
+ * and written back in input order (see Notes); otherwise they are
+ * evaluated one by one on the calling thread. Either way the operands
+ * and results live in the same Bigints for the whole batch.
+ *
+ * Parameters:
+ *  in      : stream of operations
+ *  out     : writer the results go to
+ *  base    : output base, 10, 16, 8 or 2
+ *  threads : number of worker threads
+ *
+ * Returns:
+ *  SUCCESS if every line was evaluated, FAILURE at the first line
+ *  that is malformed or cannot be evaluated, or on allocation failure.
+ *  The results of all lines before that one are written.
+ */
+int batch_eval(FILE *in, Dwriter *out, int base, int threads)
+{
+	if (threads > 1)
+		return batch_eval_pool(in, out, base, threads);
+
+	Beval e;
+	beval_init(&e);
+
+	char *line = NULL;
+	size_t cap = 0;
+	size_t lineno = 0;
+	int status = SUCCESS;
+
+	while (status == SUCCESS && getline(&line, &cap, in) != -1)
+		status = eval_line(&e, line, ++lineno, out, base);
+
+	free(line);
+	beval_free(&e);
+	return status;
+}
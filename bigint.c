@@ -0,0 +1,331 @@
+/***********************************************************************
+ *  File Name   : bigint.c
+ *  Description : Source file for the limb-array big integer type used
+ *                by the Arbitrary Precision Calculator (APC).
+ *                Implements storage management, comparison, small
+ *                word helpers and the conversion between a Bigint and
+ *                the decimal doubly linked list representation; the
+ *                decimal conversion itself lives in radix.c.
+ *
+ *                Functions:
+ *                - bi_init() / bi_free()
+ *                - bi_reserve() / bi_normalize()
+ *                - bi_copy() / bi_swap() / bi_alias() / bi_set_u32()
+ *                - bi_cmp_abs() / bi_cmp()
+ *                - bi_mul_1_add() / bi_divrem_1()
+ *                - bi_from_str() / bi_from_list() / bi_to_list()
+ *                - limb_cmp() / limb_lshift() / limb_rshift()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "bigint.h"
+#include "list.h"
+
+/*
+ * Initialises a Bigint to zero without allocating storage.
+ */
+void bi_init(Bigint *a)
+{
+	a->limb = NULL;
+	a->len = a->cap = 0;
+	a->sign = 1;
+}
+
+/*
+ * Frees the limb array and resets the Bigint to zero.
+ */
+void bi_free(Bigint *a)
+{
+	free(a->limb);
+	bi_init(a);
+}
+
+/*
+ * Function: bi_reserve
+ * --------------------
+ * Grows the limb array so that at least n limbs are available.
+ * Capacity grows geometrically so repeated appends stay linear.
+ *
+ * returns:
+ *   SUCCESS on success, FAILURE if memory allocation fails
+ */
+int bi_reserve(Bigint *a, size_t n)
+{
+	if (n <= a->cap)
+		return SUCCESS;
+
+	size_t cap = a->cap ? a->cap : 4;
+	while (cap < n)
+		cap *= 2;
+
+	limb_t *limb = realloc(a->limb, cap * sizeof(limb_t));
+	if (limb == NULL)
+		return FAILURE;
+
+	a->limb = limb;
+	a->cap = cap;
+	return SUCCESS;
+}
+
+/*
+ * Removes leading zero limbs; zero is always stored as positive.
+ */
+void bi_normalize(Bigint *a)
+{
+	while (a->len && a->limb[a->len - 1] == 0)
+		a->len--;
+	if (a->len == 0)
+		a->sign = 1;
+}
+
+/*
+ * Copies the value of src into dst.
+ */
+int bi_copy(Bigint *dst, const Bigint *src)
+{
+	if (dst == src)
+		return SUCCESS;
+	if (bi_reserve(dst, src->len) == FAILURE)
+		return FAILURE;
+
+	if (src->len)
+		memcpy(dst->limb, src->limb, src->len * sizeof(limb_t));
+	dst->len = src->len;
+	dst->sign = src->sign;
+	return SUCCESS;
+}
+
+/*
+ * Swaps two Bigints by exchanging their descriptors.
+ */
+void bi_swap(Bigint *a, Bigint *b)
+{
+	Bigint t = *a;
+	*a = *b;
+	*b = t;
+}
+
+/*
+ * Returns 1 if r is a or shares its limb storage, so results cannot be
+ * built in r's storage while a is still being read.
+ */
+int bi_alias(const Bigint *r, const Bigint *a)
+{
+	return r == a || (r->limb != NULL && r->limb == a->limb);
+}
+
+/*
+ * Sets a Bigint to a single-limb non-negative value.
+ */
+int bi_set_u32(Bigint *a, limb_t value)
+{
+	a->sign = 1;
+	a->len = 0;
+	if (value == 0)
+		return SUCCESS;
+	if (bi_reserve(a, 1) == FAILURE)
+		return FAILURE;
+	a->limb[0] = value;
+	a->len = 1;
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_cmp_abs
+ * --------------------
+ * Compares the magnitudes of two Bigints.
+ * Length decides first, then limbs from the most significant end.
+ *
+ * returns:
+ *   1 if |a| > |b|, -1 if |a| < |b|, 0 if equal
+ */
+int bi_cmp_abs(const Bigint *a, const Bigint *b)
+{
+	if (a->len != b->len)
+		return a->len > b->len ? 1 : -1;
+
+	return limb_cmp(a->limb, b->limb, a->len);
+}
+
+/*
+ * Compares two limb arrays of the same length, most significant first.
+ */
+int limb_cmp(const limb_t *a, const limb_t *b, size_t n)
+{
+	while (n-- > 0)
+	{
+		if (a[n] != b[n])
+			return a[n] > b[n] ? 1 : -1;
+	}
+	return 0;
+}
+
+/*
+ * Shifts n limbs left by cnt bits (0 <= cnt < 32): r = a << cnt.
+ * Returns the bits shifted out of the top limb.
+ */
+limb_t limb_lshift(limb_t *r, const limb_t *a, size_t n, unsigned cnt)
+{
+	if (cnt == 0)
+	{
+		memmove(r, a, n * sizeof(limb_t));
+		return 0;
+	}
+
+	limb_t out = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		limb_t t = a[i];
+		r[i] = (t << cnt) | out;
+		out = t >> (LIMB_BITS - cnt);
+	}
+	return out;
+}
+
+/*
+ * Shifts n limbs right by cnt bits (0 <= cnt < 32): r = a >> cnt.
+ * Returns the bits shifted out of the bottom limb, left-aligned.
+ */
+limb_t limb_rshift(limb_t *r, const limb_t *a, size_t n, unsigned cnt)
+{
+	if (cnt == 0)
+	{
+		memmove(r, a, n * sizeof(limb_t));
+		return 0;
+	}
+
+	limb_t out = 0;
+	for (size_t i = n; i-- > 0;)
+	{
+		limb_t t = a[i];
+		r[i] = (t >> cnt) | out;
+		out = t << (LIMB_BITS - cnt);
+	}
+	return out;
+}
+
+/*
+ * Compares two signed Bigints.
+ */
+int bi_cmp(const Bigint *a, const Bigint *b)
+{
+	if (a->sign != b->sign)
+		return a->sign > b->sign ? 1 : -1;
+	return a->sign * bi_cmp_abs(a, b);
+}
+
+/*
+ * Function: bi_mul_1_add
+ * ----------------------
+ * Multiplies the magnitude by one limb and adds another limb, in place.
+ * Used to accumulate decimal chunks while parsing.
+ */
+int bi_mul_1_add(Bigint *a, limb_t mul, limb_t add)
+{
+	dlimb_t carry = add;
+
+	for (size_t i = 0; i < a->len; i++)
+	{
+		dlimb_t t = (dlimb_t)a->limb[i] * mul + carry;
+		a->limb[i] = (limb_t)t;
+		carry = t >> LIMB_BITS;
+	}
+
+	if (carry)
+	{
+		if (bi_reserve(a, a->len + 1) == FAILURE)
+			return FAILURE;
+		a->limb[a->len++] = (limb_t)carry;
+	}
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_divrem_1
+ * ---------------------
+ * Divides the magnitude by one non-zero limb, in place.
+ *
+ * returns:
+ *   the remainder of the division
+ */
+limb_t bi_divrem_1(Bigint *a, limb_t div)
+{
+	limb_t rem = limb_divrem_1(a->limb, a->limb, a->len, div);
+	bi_normalize(a);
+	return rem;
+}
+
+/*
+ * Function: bi_from_str
+ * ---------------------
+ * Parses a NUL terminated operand string with bi_from_text(): an
+ * optional sign, then decimal digits or a 0x / 0o / 0b prefixed
+ * number.
+ *
+ * returns:
+ *   SUCCESS on success, FAILURE on an empty or invalid string or if
+ *   memory allocation fails
+ */
+int bi_from_str(Bigint *a, const char *s)
+{
+	return bi_from_text(a, s, strlen(s));
+}
+
+/*
+ * Function: bi_from_list
+ * ----------------------
+ * Builds a Bigint from a decimal digit list (MSD at head).
+ * The digits are gathered into one string so the conversion can split
+ * it anywhere, then handed to bi_from_digits().
+ *
+ * returns:
+ *   SUCCESS on success, FAILURE if memory allocation fails
+ */
+int bi_from_list(Bigint *a, Dlist *head)
+{
+	size_t n = 0;
+	for (Dlist *node = head; node; node = node->next)
+		n++;
+
+	char *digits = malloc(n + 1);
+	if (digits == NULL)
+		return FAILURE;
+
+	n = 0;
+	for (; head; head = head->next)
+		digits[n++] = (char)('0' + head->data);
+
+	int status = bi_from_digits(a, digits, n);
+	free(digits);
+	return status;
+}
+
+/*
+ * Function: bi_to_list
+ * --------------------
+ * Writes the magnitude of a Bigint as a decimal digit list.
+ * Zero produces an empty list, matching the rest of the list code.
+ *
+ * returns:
+ *   SUCCESS on success, FAILURE if memory allocation fails
+ */
+int bi_to_list(Dlist **head, Dlist **tail, const Bigint *a)
+{
+	if (a->len == 0)
+		return SUCCESS;
+
+	char *digits = malloc(bi_digits_bound(a) + 1);
+	if (digits == NULL)
+		return FAILURE;
+
+	size_t n;
+	int status = bi_to_digits(digits, &n, a);
+	for (size_t i = 0; status == SUCCESS && i < n; i++)
+		status = dl_insert_last(head, tail, digits[i] - '0');
+
+	free(digits);
+	return status;
+}
@@ -0,0 +1,333 @@
+/***********************************************************************
+ *  File Name   : bigint.h
+ *  Description : Header file for the limb-array big integer type used
+ *                by the Arbitrary Precision Calculator (APC).
+ *                A Bigint keeps its magnitude in one contiguous,
+ *                growable array of 32-bit limbs (base 2^32) with the
+ *                length and sign stored inline, so arithmetic runs
+ *                over flat memory instead of one node per digit.
+ *
+ *                Functions:
+ *                - bi_init() / bi_free()
+ *                - bi_reserve() / bi_normalize()
+ *                - bi_copy() / bi_swap() / bi_alias() / bi_set_u32()
+ *                - bi_cmp_abs() / bi_cmp()
+ *                - bi_mul_1_add() / bi_divrem_1()
+ *                - bi_from_str() / bi_from_list() / bi_to_list()
+ *                - bi_from_digits() / bi_to_digits() radix conversion
+ *                - bi_pow10() / bi_is_pow10()
+ *                - bi_add() / bi_sub() / bi_mul() / bi_sqr()
+ *                - bi_divmod() / bi_div() / bi_mod()
+ *                - bi_pow_fits() / bi_pow10_zeros() / bi_pow()
+ *                - bi_powmod() / bi_powmod_ctx()
+ *                - bi_pow_digits() / bi_eval()
+ *                - bi_save() / bi_load() / bi_map() binary records
+ *                - bi_mod_*() / bi_mont_*() modulus contexts
+ *                - limb_*() kernels on raw limb arrays
+ *
+ *  Notes:
+ *  - limb[0] is the least significant limb.
+ *  - len == 0 represents zero, and zero always has sign +1.
+ *  - Result arguments may alias operands in every bi_* operation.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef BIGINT_H
+#define BIGINT_H
+
+#include <stdint.h>
+#include "apc.h"
+
+typedef uint32_t limb_t;    // one base 2^32 digit
+typedef uint64_t dlimb_t;   // holds the product of two limbs
+
+#define LIMB_BITS 32
+
+/* Operand size (in limbs) where Karatsuba takes over from schoolbook */
+#ifndef KARATSUBA_THRESHOLD
+#define KARATSUBA_THRESHOLD 32
+#endif
+
+/* Operand size (in limbs) where Toom-3 takes over from Karatsuba */
+#ifndef TOOM3_THRESHOLD
+#define TOOM3_THRESHOLD 320
+#endif
+
+/* Operand size (in limbs) where the NTT takes over from Toom-3 */
+#ifndef NTT_THRESHOLD
+#define NTT_THRESHOLD 16384
+#endif
+
+/* Divisor and quotient size (in limbs) where divide-and-conquer division takes over */
+#ifndef DIV_DC_THRESHOLD
+#define DIV_DC_THRESHOLD 48
+#endif
+
+/* Modulus size (in limbs) where Barrett reduction moves from short schoolbook
+ * products to full products */
+#ifndef BARRETT_THRESHOLD
+#define BARRETT_THRESHOLD 128
+#endif
+
+/* Squaring crossovers (in limbs) for Karatsuba and the NTT */
+#ifndef SQR_KARATSUBA_THRESHOLD
+#define SQR_KARATSUBA_THRESHOLD 48
+#endif
+#ifndef SQR_NTT_THRESHOLD
+#define SQR_NTT_THRESHOLD 8192
+#endif
+
+/* Number size (in limbs) where decimal conversion switches to divide and conquer */
+#ifndef RADIX_DC_THRESHOLD
+#define RADIX_DC_THRESHOLD 30
+#endif
+
+/* Largest power result (in decimal digits) bi_pow() will build */
+#ifndef POW_MAX_DIGITS
+#define POW_MAX_DIGITS 100000000
+#endif
+
+/* Version of the binary record written by bi_save() */
+#define BI_SERIAL_VERSION 1
+
+/* Longest product (in limbs) the three-prime NTT computes exactly */
+#define NTT_MAX_LEN ((size_t)1 << 24)
+
+typedef struct
+{
+	limb_t *limb;   // little-endian limb array
+	size_t len;     // limbs in use (no leading zero limbs)
+	size_t cap;     // limbs allocated
+	int sign;       // 1 = positive, -1 = negative
+} Bigint;
+
+/* Modulus context: constants for repeated reduction against one modulus */
+typedef struct
+{
+	Bigint m;       // the modulus (positive)
+	Bigint mu;      // Barrett constant B^2n / m
+	Bigint r2;      // B^2n mod m, i.e. R^2 mod m with R = B^n
+	size_t n;       // limbs in m
+	int odd;        // 1 if m is odd and the Montgomery constants are set
+	limb_t minv;    // -m^-1 mod B
+} Bimod;
+
+/* File mapping behind a Bigint loaded with bi_map() (addr is NULL when copied) */
+typedef struct
+{
+	void *addr;     // start of the mapping
+	size_t size;    // bytes mapped
+} Bimap;
+
+/* Run-time tunable crossovers (default to the macros above) */
+extern size_t karatsuba_threshold;
+extern size_t toom3_threshold;
+extern size_t ntt_threshold;
+extern size_t sqr_karatsuba_threshold;
+extern size_t sqr_ntt_threshold;
+extern size_t div_dc_threshold;
+extern size_t barrett_threshold;
+extern size_t radix_dc_threshold;
+
+/* Run-time result size limit for bi_pow() (defaults to POW_MAX_DIGITS) */
+extern size_t pow_max_digits;
+
+/* Initialise an empty Bigint (value zero, no storage) */
+void bi_init(Bigint *a);
+
+/* Release the storage of a Bigint and reset it to zero */
+void bi_free(Bigint *a);
+
+/* Make room for at least n limbs */
+int bi_reserve(Bigint *a, size_t n);
+
+/* Drop leading zero limbs and fix the sign of zero */
+void bi_normalize(Bigint *a);
+
+/* Copy src into dst */
+int bi_copy(Bigint *dst, const Bigint *src);
+
+/* Exchange two Bigints without copying limbs */
+void bi_swap(Bigint *a, Bigint *b);
+
+/* 1 if r is a or shares its storage */
+int bi_alias(const Bigint *r, const Bigint *a);
+
+/* Set a Bigint to a small non-negative value */
+int bi_set_u32(Bigint *a, limb_t value);
+
+/* Compare magnitudes: 1 if |a| > |b|, -1 if |a| < |b|, 0 if equal */
+int bi_cmp_abs(const Bigint *a, const Bigint *b);
+
+/* Compare signed values */
+int bi_cmp(const Bigint *a, const Bigint *b);
+
+/* In-place a = a * mul + add on the magnitude */
+int bi_mul_1_add(Bigint *a, limb_t mul, limb_t add);
+
+/* In-place a = a / div on the magnitude, returns the remainder */
+limb_t bi_divrem_1(Bigint *a, limb_t div);
+
+/* Parse an optionally signed decimal or 0x / 0o / 0b prefixed string */
+int bi_from_str(Bigint *a, const char *s);
+int bi_from_text(Bigint *a, const char *s, size_t n);
+
+/* Convert n decimal digit characters (no sign) into a non-negative Bigint,
+ * failing on any other character */
+int bi_from_digits(Bigint *a, const char *s, size_t n);
+
+/* Upper bound on the decimal digits of |a| (at least 1) */
+size_t bi_digits_bound(const Bigint *a);
+
+/* r = 10^k from the cached powers of ten, and whether |a| = 10^j (j > 0) */
+int bi_pow10(Bigint *r, size_t k);
+int bi_is_pow10(const Bigint *a, size_t *j);
+
+/* Write |a| in decimal into buf (bi_digits_bound(a) + 1 bytes), NUL terminated */
+int bi_to_digits(char *buf, size_t *n, const Bigint *a);
+
+/* Linear conversions for base 2^bits (bits = 1, 3, 4): digits without prefix */
+int bi_from_radix2(Bigint *a, const char *s, size_t n, unsigned bits);
+size_t bi_radix2_bound(const Bigint *a, unsigned bits);
+size_t bi_to_radix2(char *buf, const Bigint *a, unsigned bits);
+
+/* Convert a decimal digit list into a Bigint (non-negative) */
+int bi_from_list(Bigint *a, Dlist *head);
+
+/* Convert the magnitude of a Bigint into a decimal digit list */
+int bi_to_list(Dlist **head, Dlist **tail, const Bigint *a);
+
+/* Magnitude helpers: r = |a| + |b| and r = |a| - |b| (needs |a| >= |b|) */
+int bi_add_abs(Bigint *r, const Bigint *a, const Bigint *b);
+int bi_sub_abs(Bigint *r, const Bigint *a, const Bigint *b);
+
+/* Signed arithmetic */
+int bi_add(Bigint *r, const Bigint *a, const Bigint *b);
+int bi_sub(Bigint *r, const Bigint *a, const Bigint *b);
+int bi_mul(Bigint *r, const Bigint *a, const Bigint *b);
+int bi_sqr(Bigint *r, const Bigint *a);
+
+/* Truncating division: quotient rounds toward zero, remainder takes the dividend's sign */
+int bi_divmod(Bigint *q, Bigint *r, const Bigint *a, const Bigint *b);
+int bi_div(Bigint *q, const Bigint *a, const Bigint *b);
+int bi_mod(Bigint *r, const Bigint *a, const Bigint *b);
+
+/* Modulus context: set up once, then reduce many values against it */
+int bi_mod_init(Bimod *ctx, const Bigint *m);
+void bi_mod_free(Bimod *ctx);
+int bi_mod_reduce(Bigint *r, const Bigint *a, const Bimod *ctx);
+int bi_mod_mul(Bigint *r, const Bigint *a, const Bigint *b, const Bimod *ctx);
+
+/* Montgomery form for odd moduli, operands in 0 .. m-1 */
+int bi_mont_in(Bigint *r, const Bigint *a, const Bimod *ctx);
+int bi_mont_out(Bigint *r, const Bigint *a, const Bimod *ctx);
+int bi_mont_mul(Bigint *r, const Bigint *a, const Bigint *b, const Bimod *ctx);
+
+/* Whether base ^ exp is within the size bi_pow() accepts (1) or not (0) */
+int bi_pow_fits(const Bigint *base, const Bigint *exp);
+
+/* Whether base ^ exp is ±10^k within the limit: k in *zeros, sign in *sign */
+int bi_pow10_zeros(const Bigint *base, const Bigint *exp, size_t *zeros, int *sign);
+
+/* r = base ^ exp for a non-negative exponent, up to pow_max_digits digits */
+int bi_pow(Bigint *r, const Bigint *base, const Bigint *exp);
+
+/* r = base ^ exp mod |m| in 0 .. |m|-1, for exp >= 0 and m != 0 */
+int bi_powmod(Bigint *r, const Bigint *base, const Bigint *exp, const Bigint *m);
+
+/* r = base ^ exp mod m in 0 .. m-1, for exp >= 0, with a prepared context */
+int bi_powmod_ctx(Bigint *r, const Bigint *base, const Bigint *exp, const Bimod *ctx);
+
+/* Estimated decimal digits of base ^ exp (0 when it stays small) */
+double bi_pow_digits(const Bigint *base, const Bigint *exp);
+
+/* Calculator operator ('+', '-', 'x', '/', '%', 'd', '^') on Bigints;
+ * rem receives the remainder of 'd', m is the modulus of a modular power */
+int bi_eval(Bigint *r, Bigint *rem, char op, const Bigint *a, const Bigint *b, const Bigint *m);
+
+/* Binary records: header (version, byte order, sign, limb count) + raw limbs */
+int bi_save(const Bigint *a, FILE *out);
+int bi_load(Bigint *a, FILE *in);
+int bi_is_record(const void *p, size_t size);
+
+/* Load a record in memory as a read-only view of it (*view = 1) or, on a
+ * byte order mismatch or misalignment, as a copy (*view = 0) */
+int bi_view_record(Bigint *a, const void *p, size_t size, int *view);
+
+/* Load a binary file as a read-only view of its mapping (copied on a byte
+ * order mismatch); release with bi_unmap() */
+int bi_map(Bigint *a, Bimap *map, const char *path);
+void bi_unmap(Bigint *a, Bimap *map);
+
+/*
+ * Limb-array kernels. They work on raw little-endian limb arrays,
+ * never allocate and never normalise; the caller sizes the output.
+ */
+
+/* r = a * b for n limbs, returns the carry limb */
+limb_t limb_mul_1(limb_t *r, const limb_t *a, size_t n, limb_t b);
+
+/* r += a * b for n limbs, returns the carry limb */
+limb_t limb_addmul_1(limb_t *r, const limb_t *a, size_t n, limb_t b);
+
+/* Schoolbook product into na + nb limbs (r must not overlap a or b) */
+void limb_mul_basecase(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* Product into na + nb limbs, picks the algorithm by operand size */
+int limb_mul(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* Karatsuba product into na + nb limbs, na >= nb (r must not overlap a or b) */
+int limb_mul_karatsuba(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* Long by short product cut into nb-limb slices, ws holding 2 * nb limbs */
+int limb_mul_sliced(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, limb_t *ws);
+
+/* Toom-3 product into na + nb limbs, na >= nb > 2 * ceil(na / 3) */
+int limb_mul_toom3(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* NTT product into na + nb limbs, na + nb <= NTT_MAX_LEN; a == b squares */
+int limb_mul_ntt(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* Squaring kernels into 2n limbs (r must not overlap a) */
+void limb_sqr_basecase(limb_t *r, const limb_t *a, size_t n);
+int limb_sqr_karatsuba(limb_t *r, const limb_t *a, size_t n);
+int limb_sqr(limb_t *r, const limb_t *a, size_t n);
+
+/* r -= a * b for n limbs, returns the borrow limb */
+limb_t limb_submul_1(limb_t *r, const limb_t *a, size_t n, limb_t b);
+
+/* Division by one limb with a precomputed reciprocal: q = a / d (q may be a or NULL), returns the remainder */
+limb_t limb_divrem_1(limb_t *q, const limb_t *a, size_t n, limb_t d);
+
+/* Division of a normalized operand (top bit of d set, dn >= 2):
+ * q[0 .. nn-dn) = np / d, remainder left in np[0 .. dn) */
+limb_t limb_div_basecase(limb_t *q, limb_t *np, size_t nn, const limb_t *d, size_t dn);
+int limb_div_dc(limb_t *q, limb_t *np, size_t nn, const limb_t *d, size_t dn);
+
+/* Long division: q[0 .. na-nb] = a / b, r[0 .. nb) = a % b; q or r may be NULL */
+int limb_divrem(limb_t *q, limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* Compare n limbs: 1, -1 or 0 */
+int limb_cmp(const limb_t *a, const limb_t *b, size_t n);
+
+/* Shift n limbs by 0 <= cnt < 32 bits, return the bits shifted out */
+limb_t limb_lshift(limb_t *r, const limb_t *a, size_t n, unsigned cnt);
+limb_t limb_rshift(limb_t *r, const limb_t *a, size_t n, unsigned cnt);
+
+/* Addition kernels, return the carry out (0 or 1); na >= nb */
+limb_t limb_add_n(limb_t *r, const limb_t *a, const limb_t *b, size_t n);
+limb_t limb_add_1(limb_t *r, const limb_t *a, size_t n, limb_t c);
+limb_t limb_add(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* Subtraction kernels, return the borrow out (0 or 1); na >= nb */
+limb_t limb_sub_n(limb_t *r, const limb_t *a, const limb_t *b, size_t n);
+limb_t limb_sub_1(limb_t *r, const limb_t *a, size_t n, limb_t c);
+limb_t limb_sub(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+/* r[0 .. na) = |a - b| for na >= nb, returns 1 if a >= b else -1 */
+int limb_diff(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb);
+
+#endif /* BIGINT_H */
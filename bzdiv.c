@@ -0,0 +1,124 @@
+/***********************************************************************
+ *  File Name   : bzdiv.c
+ *  Description : Source file for divide-and-conquer division in the
+ *                Arbitrary Precision Calculator (APC).
+ *                Follows the Burnikel-Ziegler recursion: the quotient
+ *                is found half at a time from the top halves of the
+ *                operands, and the part of the divisor left out is
+ *                taken off with one fast multiplication, so a division
+ *                costs O(M(n) log n) where M is the multiplication in
+ *                use (Karatsuba, Toom-3 or the NTT).
+ *
+ *                Functions:
+ *                - limb_div_dc()
+ *
+ *  Notes       :
+ *  - The crossover is div_dc_threshold (in limbs of divisor and of
+ *    quotient). It defaults to DIV_DC_THRESHOLD and can be changed at
+ *    build time with -DDIV_DC_THRESHOLD=n or at run time by assigning
+ *    the variable.
+ *  - Like limb_div_basecase(), it works on a normalized divisor and
+ *    leaves the remainder in the low limbs of the dividend.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "bigint.h"
+
+size_t div_dc_threshold = DIV_DC_THRESHOLD;
+
+/*
+ * Function: div_dc
+ * ----------------
+ * Finds qn <= dn quotient limbs: q[0 .. qn) = np / d for np of dn + qn
+ * limbs, leaving the remainder in np[0 .. dn). The quotient limb
+ * above q (0 or 1) goes to *qh. tp is scratch of dn limbs.
+ *
+ *   qn == dn: the top half of the quotient, then the bottom half,
+ *             each as a qn < dn division
+ *   qn <  dn: divide the top 2qn limbs of np by the top qn limbs of d
+ *             (a balanced division), subtract q times the low limbs of
+ *             d and add d back while the remainder is negative. The
+ *             top-limb estimate is never too small, so the remainder
+ *             ends up below d.
+ */
+static int div_dc(limb_t *q, limb_t *qh, limb_t *np, const limb_t *d, size_t dn, size_t qn, limb_t *tp)
+{
+	if (qn < div_dc_threshold || qn < 2)
+	{
+		*qh = limb_div_basecase(q, np, dn + qn, d, dn);
+		return SUCCESS;
+	}
+
+	if (qn == dn)
+	{
+		size_t lo = qn / 2, hi = qn - lo;
+		limb_t ql;
+
+		// The top step leaves a remainder below d, so ql is always 0
+		if (div_dc(q + lo, qh, np + lo, d, dn, hi, tp) == FAILURE)
+			return FAILURE;
+		return div_dc(q, &ql, np, d, dn, lo, tp);
+	}
+
+	size_t lo = dn - qn;
+
+	// Estimate from the top: np[lo .. dn+qn) / d[lo .. dn)
+	if (div_dc(q, qh, np + lo, d + lo, qn, qn, tp) == FAILURE)
+		return FAILURE;
+
+	// Take off the part of q * d the estimate did not see
+	if (limb_mul(tp, q, qn, d, lo) == FAILURE)
+		return FAILURE;
+	limb_t cy = limb_sub_n(np, np, tp, dn);
+	if (*qh)
+		cy += limb_sub_n(np + qn, np + qn, d, lo);
+
+	// Remainder went negative: the estimate was too large
+	while (cy)
+	{
+		*qh -= limb_sub_1(q, q, qn, 1);
+		cy -= limb_add_n(np, np, d, dn);
+	}
+	return SUCCESS;
+}
+
+/*
+ * Function: limb_div_dc
+ * ---------------------
+ * Divide-and-conquer division of a normalized operand:
+ * q[0 .. nn-dn) = np / d with the remainder left in np[0 .. dn).
+ * Needs the top bit of d[dn-1] set and the top dn limbs of np below d.
+ * q must not overlap np or d.
+ *
+ * The quotient is produced dn limbs at a time from the top, each
+ * block a balanced 2dn by dn division; the first block takes whatever
+ * is left over.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if scratch memory cannot be allocated.
+ */
+int limb_div_dc(limb_t *q, limb_t *np, size_t nn, const limb_t *d, size_t dn)
+{
+	limb_t *tp = malloc(dn * sizeof(limb_t));
+	if (tp == NULL)
+		return FAILURE;
+
+	size_t qn = nn - dn;
+	size_t first = qn % dn ? qn % dn : dn;
+	size_t j = qn - first;
+	limb_t qh;
+
+	int status = div_dc(q + j, &qh, np + j, d, dn, first, tp);
+	while (status == SUCCESS && j > 0)
+	{
+		j -= dn;
+		status = div_dc(q + j, &qh, np + j, d, dn, dn, tp);
+	}
+
+	free(tp);
+	return status;
+}
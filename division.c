@@ -2,11 +2,31 @@
  *  File Name   : division.c
  *  Description : Source file for division operation in the 
  *                Arbitrary Precision Calculator (APC).
- *                Implements long division (manual method) 
- *                on large numbers represented as doubly linked lists.
+ *                Implements normalized long division (Knuth's
+ *                Algorithm D) on large numbers stored as Bigint limb
+ *                arrays. One pass yields both the quotient and the
+ *                remainder; division, modulus and the exponent halving
+ *                of power are all built on it.
  *
  *                Functions:
- *                - division()
+ *                - limb_divrem_1()
+ *                - limb_div_basecase()
+ *                - limb_divrem()
+ *                - bi_divmod() / bi_div()
+ *                - divmod() / division()
+ *
+ *  Notes       :
+ *  - The divisor is shifted so its top bit is set; each quotient limb
+ *    is then estimated from the top two remainder limbs and is at most
+ *    two too large, which the second divisor limb nearly always
+ *    catches before the multiply-and-subtract step.
+ *  - The remainder is kept in one working array and updated in place,
+ *    so a schoolbook division costs O(na * nb) limb operations and
+ *    two buffers.
+ *  - A one-limb divisor takes a single pass with a precomputed
+ *    reciprocal of the divisor instead of a hardware division per limb.
+ *  - Above div_dc_threshold limbs (divisor and quotient) the division
+ *    switches to the divide-and-conquer kernel in bzdiv.c.
  *
  *  Author      : Pankaj Kumar
  *  Roll No     : 25008_018
@@ -15,98 +35,376 @@
 
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
 
-/* 
- * Function: division
- * ------------------
- * Performs division of two big integers represented as doubly linked lists.
- * Implements the long division method (like manual pen-and-paper division).
- *
- * head1, tail1 : dividend (numerator)
- * head2, tail2 : divisor (denominator)
- * headR, tailR : quotient (result of division)
- *
- * returns:
- *   SUCCESS if operation succeeds
- *   FAILURE if divisor = 0
+/*
+ * Number of leading zero bits in a non-zero limb.
  */
-int division(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
+static unsigned limb_clz(limb_t x)
 {
-	// Check divide-by-zero
-	if (*head2 == NULL)
+	unsigned n = 0;
+
+	while (!(x & ((limb_t)1 << (LIMB_BITS - 1))))
 	{
-		fprintf(stderr, "❌ ERROR: Divide by zero !\n");
-		return FAILURE;
+		x <<= 1;
+		n++;
 	}
+	return n;
+}
 
-	// If dividend is empty or smaller than divisor → quotient = 0
-	if (*head1 == NULL || compare_list(*head1, *head2) < 0)
-		return SUCCESS;
+/*
+ * Reciprocal of a normalized limb (top bit set): v = (B^2 - 1) / d - B.
+ */
+static limb_t limb_inverse(limb_t d)
+{
+	return (limb_t)((((dlimb_t)~d << LIMB_BITS) | ~(limb_t)0) / d);
+}
 
-	Dlist *temp1 = *head1;  // pointer to traverse dividend
-	Dlist *list1_head = NULL, *list1_tail = NULL; // current portion of dividend
+/*
+ * Divides the two-limb value (u1, u0) by a normalized d with its
+ * reciprocal v (Moller and Granlund, "Improved division by invariant
+ * integers"): one multiplication and at most two corrections instead
+ * of a hardware division. Needs u1 < d.
+ */
+static inline limb_t div_preinv(limb_t *rem, limb_t u1, limb_t u0, limb_t d, limb_t v)
+{
+	dlimb_t qq = (dlimb_t)v * u1 + (((dlimb_t)u1 << LIMB_BITS) | u0);
+	limb_t q1 = (limb_t)(qq >> LIMB_BITS) + 1, q0 = (limb_t)qq;
+	limb_t r = u0 - q1 * d;
 
-	// Step 1: Find length of divisor
-	int len_divisor = 0;
-	for (Dlist *t = *head2; t; t = t->next)
-		len_divisor++;
+	// First correction is taken about half the time, so it is done with a mask
+	limb_t mask = -(limb_t)(r > q0);
+	q1 += mask;
+	r += mask & d;
 
-	// Step 2: Copy first "len_divisor" digits from dividend into list1_head
-	for (int i = 0; i < len_divisor && temp1; i++)
+	if (r >= d)
 	{
-		dl_insert_last(&list1_head, &list1_tail, temp1->data);
-		temp1 = temp1->next;
+		q1++;
+		r -= d;
 	}
+	*rem = r;
+	return q1;
+}
 
-	// Step 3: If copied part < divisor, include one more digit
-	if (compare_list(list1_head, *head2) < 0 && temp1)
+/*
+ * Function: limb_divrem_1
+ * -----------------------
+ * Divides n limbs by one non-zero limb: q = a / d, in one pass from
+ * the top. The divisor is normalized once and its reciprocal taken, so
+ * every limb costs a multiplication rather than a division; the
+ * dividend is shifted on the fly instead of being copied.
+ * q may be a, or NULL when only the remainder is needed.
+ *
+ * returns:
+ *   the remainder of the division
+ */
+limb_t limb_divrem_1(limb_t *q, const limb_t *a, size_t n, limb_t d)
+{
+	if (n == 0)
+		return 0;
+
+	unsigned shift = limb_clz(d);
+	d <<= shift;
+	limb_t v = limb_inverse(d);
+	limb_t r = 0, qi;
+
+	if (shift == 0)
 	{
-		dl_insert_last(&list1_head, &list1_tail, temp1->data);
-		temp1 = temp1->next;
+		for (size_t i = n; i-- > 0;)
+		{
+			qi = div_preinv(&r, r, a[i], d, v);
+			if (q)
+				q[i] = qi;
+		}
+		return r;
 	}
 
-	// Step 4: Perform long division digit by digit
-	while (list1_head)
+	// r starts with the bits shifted out of the top limb, which are below d
+	r = a[n - 1] >> (LIMB_BITS - shift);
+	for (size_t i = n; i-- > 0;)
 	{
-		int div = 0; // quotient digit for this step
+		limb_t u0 = a[i] << shift;
+		if (i)
+			u0 |= a[i - 1] >> (LIMB_BITS - shift);
+		qi = div_preinv(&r, r, u0, d, v);
+		if (q)
+			q[i] = qi;
+	}
+	return r >> shift;
+}
+
+/*
+ * Function: limb_div_basecase
+ * ---------------------------
+ * Schoolbook long division of a normalized operand (Knuth, TAOCP
+ * vol. 2, Algorithm D, steps D3 - D7): q[0 .. nn-dn) = np / d with the
+ * remainder left in np[0 .. dn). Needs dn >= 2 and the top bit of
+ * d[dn-1] set. q must not overlap np or d.
+ *
+ * Steps, for each quotient limb from the top:
+ *   D3  qhat = (u[j+dn] B + u[j+dn-1]) / d[dn-1], lowered while it is
+ *       too big for the top three limbs (at most twice)
+ *   D4  u[j .. j+dn] -= qhat * d
+ *   D6  if that went negative, qhat was one too big: add d back
+ *
+ * returns:
+ *   the quotient limb above q, 1 if the top dn limbs of np were >= d
+ */
+limb_t limb_div_basecase(limb_t *q, limb_t *np, size_t nn, const limb_t *d, size_t dn)
+{
+	limb_t dtop = d[dn - 1], dnext = d[dn - 2];
 
-		// Remove leading zeros in the partial dividend
-		delete_leading_zero(&list1_head, &list1_tail);
+	// The top dn limbs may hold one more multiple of d
+	limb_t qh = limb_cmp(np + nn - dn, d, dn) >= 0;
+	if (qh)
+		limb_sub_n(np + nn - dn, np + nn - dn, d, dn);
 
-		// Repeated subtraction: while partial dividend >= divisor
-		while (list1_head && compare_list(list1_head, *head2) >= 0)
-		{
-			Dlist *subtract_head = NULL, *subtract_tail = NULL;
+	for (size_t j = nn - dn; j-- > 0;)
+	{
+		// D3: estimate the quotient limb from the top of the remainder
+		dlimb_t num = ((dlimb_t)np[j + dn] << LIMB_BITS) | np[j + dn - 1];
+		dlimb_t qhat = num / dtop, rhat = num % dtop;
 
-			// Subtract divisor from current dividend part
-			subtraction(&list1_head, &list1_tail, head2, tail2, &subtract_head, &subtract_tail);
+		while (qhat >> LIMB_BITS ||
+			   qhat * dnext > ((rhat << LIMB_BITS) | np[j + dn - 2]))
+		{
+			qhat--;
+			rhat += dtop;
+			if (rhat >> LIMB_BITS)
+				break;
+		}
 
-			// Free old partial dividend and update with result
-			dl_delete_list(&list1_head, &list1_tail);
-			if (subtract_head == NULL) // if subtraction gave 0
-			{
-				dl_insert_last(&subtract_head, &subtract_tail, 0);
-			}
-			list1_head = subtract_head;
-			list1_tail = subtract_tail;
+		// D4: multiply and subtract in place
+		limb_t borrow = limb_submul_1(np + j, d, dn, (limb_t)qhat);
+		limb_t top = np[j + dn];
+		np[j + dn] = top - borrow;
 
-			div++; // count how many times divisor fits
+		// D6: the estimate was one too large, add the divisor back
+		if (top < borrow)
+		{
+			qhat--;
+			np[j + dn] += limb_add_n(np + j, np + j, d, dn);
 		}
 
-		// Store this quotient digit in result
-		dl_insert_last(headR, tailR, div);
+		q[j] = (limb_t)qhat;
+	}
+	return qh;
+}
+
+/*
+ * Function: limb_divrem
+ * ---------------------
+ * Long division of limb arrays: q[0 .. na-nb] = a / b and
+ * r[0 .. nb) = a % b, for na >= nb >= 1 and b[nb-1] != 0. Either q or
+ * r may be NULL when that part is not needed. q and r must not overlap
+ * a or b.
+ *
+ * The divisor is first shifted so its top bit is set (step D1) and the
+ * dividend by the same amount into one extra limb; the remainder is
+ * shifted back at the end (step D8). Large divisions go to the
+ * divide-and-conquer kernel, the rest to limb_div_basecase().
+ *
+ * returns:
+ *   SUCCESS, or FAILURE if the working arrays cannot be allocated
+ */
+int limb_divrem(limb_t *q, limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	if (nb == 1)
+	{
+		limb_t rem = limb_divrem_1(q, a, na, b[0]);
+		if (r)
+			r[0] = rem;
+		return SUCCESS;
+	}
+
+	/* u: normalized dividend with one extra top limb, v: normalized divisor */
+	size_t qn = na - nb + 1;
+	limb_t *u = malloc((na + 1 + nb + (q ? 0 : qn)) * sizeof(limb_t));
+	if (u == NULL)
+		return FAILURE;
+	limb_t *v = u + na + 1;
+	limb_t *quo = q ? q : v + nb;
+
+	// D1: normalize
+	unsigned shift = limb_clz(b[nb - 1]);
+	limb_lshift(v, b, nb, shift);
+	u[na] = limb_lshift(u, a, na, shift);
+
+	// The extra top limb is below v, so there is no quotient limb above quo
+	int status = SUCCESS;
+	if (nb >= div_dc_threshold && qn >= div_dc_threshold)
+		status = limb_div_dc(quo, u, na + 1, v, nb);
+	else
+		limb_div_basecase(quo, u, na + 1, v, nb);
+
+	// D8: unnormalize the remainder
+	if (status == SUCCESS && r)
+		limb_rshift(r, u, nb, shift);
+
+	free(u);
+	return status;
+}
+
+/* 
+ * Function: bi_divmod
+ * -------------------
+ * Divides two Bigints in one pass: q = a / b rounding toward zero and
+ * r = a - q * b, which takes the sign of the dividend.
+ * Either q or r may be NULL when that part is not needed; q and r must
+ * be different Bigints but may alias a or b.
+ *
+ * returns:
+ *   SUCCESS if operation succeeds
+ *   FAILURE if divisor = 0 or memory allocation fails
+ */
+int bi_divmod(Bigint *q, Bigint *r, const Bigint *a, const Bigint *b)
+{
+	// Check divide-by-zero
+	if (b->len == 0)
+		return FAILURE;
+
+	// If |dividend| < |divisor| → quotient = 0, remainder = dividend
+	if (bi_cmp_abs(a, b) < 0)
+	{
+		if (r && bi_copy(r, a) == FAILURE)
+			return FAILURE;
+		return q ? bi_set_u32(q, 0) : SUCCESS;
+	}
+
+	// Word-sized divisor: one pass, quotient written straight into q
+	if (b->len == 1)
+	{
+		limb_t d = b->limb[0];
+		int qsign = a->sign * b->sign, rsign = a->sign;
 
-		// Bring down the next digit from dividend (if any left)
-		if (temp1)
+		if (q && bi_reserve(q, a->len) == FAILURE)
+			return FAILURE;
+		limb_t rem = limb_divrem_1(q ? q->limb : NULL, a->limb, a->len, d);
+		if (q)
+		{
+			q->len = a->len;
+			q->sign = qsign;
+			bi_normalize(q);
+		}
+		if (r)
 		{
-			dl_insert_last(&list1_head, &list1_tail, temp1->data);
-			temp1 = temp1->next;
+			if (bi_set_u32(r, rem) == FAILURE)
+				return FAILURE;
+			r->sign = rem ? rsign : 1;
 		}
-		else
-			break; // no more digits → division complete
+		return SUCCESS;
+	}
+
+	// Results go straight into q and r unless they alias an operand
+	Bigint quo, rem;
+	bi_init(&quo);
+	bi_init(&rem);
+	Bigint *pq = q && !bi_alias(q, a) && !bi_alias(q, b) ? q : &quo;
+	Bigint *pr = r && !bi_alias(r, a) && !bi_alias(r, b) ? r : &rem;
+
+	size_t n = a->len - b->len + 1;
+	if ((q && bi_reserve(pq, n) == FAILURE) || (r && bi_reserve(pr, b->len) == FAILURE) ||
+		limb_divrem(q ? pq->limb : NULL, r ? pr->limb : NULL, a->limb, a->len, b->limb, b->len) == FAILURE)
+	{
+		bi_free(&quo);
+		bi_free(&rem);
+		return FAILURE;
 	}
 
-	// Free leftover partial dividend
-	dl_delete_list(&list1_head, &list1_tail);
+	// Signs are taken before the swaps, which may overwrite a or b
+	int qsign = a->sign * b->sign, rsign = a->sign;
+	pq->len = q ? n : 0;
+	pq->sign = qsign;
+	pr->len = r ? b->len : 0;
+	pr->sign = rsign;
+	bi_normalize(pq);
+	bi_normalize(pr);
+
+	if (pq == &quo && q)
+		bi_swap(q, &quo);
+	if (pr == &rem && r)
+		bi_swap(r, &rem);
+
+	bi_free(&quo);
+	bi_free(&rem);
 	return SUCCESS;
-}
\ No newline at end of file
+}
+
+/*
+ * Divides two Bigints: q = a / b, rounding toward zero.
+ */
+int bi_div(Bigint *q, const Bigint *a, const Bigint *b)
+{
+	return bi_divmod(q, NULL, a, b);
+}
+
+/* 
+ * Function: divmod
+ * ----------------
+ * Divides two big integers represented as doubly linked lists and
+ * produces the quotient and the remainder from a single division.
+ *
+ * head1, tail1 : dividend (numerator)
+ * head2, tail2 : divisor (denominator)
+ * headQ, tailQ : quotient list (may be NULL if not needed)
+ * headR, tailR : remainder list (may be NULL if not needed)
+ *
+ * returns:
+ *   SUCCESS if operation succeeds
+ *   FAILURE if divisor = 0 or memory allocation fails
+ */
+int divmod(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2,
+		   Dlist **headQ, Dlist **tailQ, Dlist **headR, Dlist **tailR)
+{
+	// Check divide-by-zero
+	if (*head2 == NULL)
+	{
+		fprintf(stderr, "❌ ERROR: Divide by zero !\n");
+		return FAILURE;
+	}
+
+	// If dividend is empty → quotient = remainder = 0
+	if (*head1 == NULL)
+		return SUCCESS;
+
+	Bigint a, b, q, r;
+	bi_init(&a);
+	bi_init(&b);
+	bi_init(&q);
+	bi_init(&r);
+
+	int status = FAILURE;
+	if (bi_from_list(&a, *head1) == SUCCESS && bi_from_list(&b, *head2) == SUCCESS &&
+		bi_divmod(headQ ? &q : NULL, headR ? &r : NULL, &a, &b) == SUCCESS)
+	{
+		status = SUCCESS;
+		if (headQ && bi_to_list(headQ, tailQ, &q) == FAILURE)
+			status = FAILURE;
+		if (headR && bi_to_list(headR, tailR, &r) == FAILURE)
+			status = FAILURE;
+	}
+
+	bi_free(&a);
+	bi_free(&b);
+	bi_free(&q);
+	bi_free(&r);
+	return status;
+}
+
+/* 
+ * Function: division
+ * ------------------
+ * Performs division of two big integers represented as doubly linked lists.
+ *
+ * head1, tail1 : dividend (numerator)
+ * head2, tail2 : divisor (denominator)
+ * headR, tailR : quotient (result of division)
+ *
+ * returns:
+ *   SUCCESS if operation succeeds
+ *   FAILURE if divisor = 0
+ */
+int division(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
+{
+	return divmod(head1, tail1, head2, tail2, headR, tailR, NULL, NULL);
+}
@@ -0,0 +1,144 @@
+/***********************************************************************
+ *  File Name   : eval.c
+ *  Description : Source file for the Bigint operation dispatcher of the
+ *                Arbitrary Precision Calculator (APC).
+ *                Runs one calculator operation directly on Bigints,
+ *                with the same operators, sign rules and error
+ *                messages as the digit-list path in main(), for callers
+ *                that never hold their numbers as digit lists.
+ *
+ *                Functions:
+ *                - bi_pow_digits()
+ *                - bi_eval()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <math.h>
+#include "apc.h"
+#include "bigint.h"
+
+/*
+ * Function: bi_pow_digits
+ * -----------------------
+ * Estimates the number of decimal digits of base ^ exp for a
+ * non-negative exponent, without building it, so a caller can refuse
+ * a power beyond pow_max_digits before spending time on it.
+ *
+ * Returns:
+ *  The estimate, or 0 when the result stays small for any exponent
+ *  (base 0, 1 or -1, or exponent 0).
+ */
+double bi_pow_digits(const Bigint *base, const Bigint *exp)
+{
+	// 0, 1 and -1 stay small for any exponent
+	if (base->len == 0 || exp->len == 0 || (base->len == 1 && base->limb[0] == 1))
+		return 0;
+
+	// Top two limbs of each operand as doubles are plenty for an estimate
+	double e = 0, b = 0;
+	for (size_t i = exp->len; i-- > 0;)
+		e = e * 4294967296.0 + exp->limb[i];
+	size_t top = base->len < 2 ? base->len : 2;
+	for (size_t i = 0; i < top; i++)
+		b = b * 4294967296.0 + base->limb[base->len - 1 - i];
+
+	return e * (log10(b) + (double)(base->len - top) * LIMB_BITS * 0.30102999566398120);
+}
+
+/*
+ * Checks a power before it is built: the exponent must be non-negative
+ * and the result must stay within pow_max_digits decimal digits.
+ */
+static int check_power(const Bigint *base, const Bigint *exp)
+{
+	if (exp->sign < 0)
+	{
+		fprintf(stderr, "❌ ERROR: Negative exponent not supported !\n");
+		return FAILURE;
+	}
+
+	// bi_pow_fits() is the bound bi_pow() enforces; the estimate is for the message
+	if (!bi_pow_fits(base, exp))
+	{
+		fprintf(stderr, "❌ ERROR: Result would have about %.3g digits, the limit is %zu !\n",
+				bi_pow_digits(base, exp), pow_max_digits);
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_eval
+ * -----------------
+ * Computes a op b into r for the calculator operators
+ * '+', '-', 'x' (or '*'), '/', '%', 'd' and '^'. Division truncates toward
+ * zero and the remainder takes the dividend's sign, as in main().
+ *
+ * Parameters:
+ *  r   : result (the quotient for 'd')
+ *  rem : remainder for 'd', unused otherwise (may be NULL then)
+ *  op  : operator character
+ *  a   : first operand
+ *  b   : second operand
+ *  m   : modulus for '^' (base ^ exp mod m), or NULL
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on an unknown operator, a zero divisor or
+ *  modulus, an invalid exponent or memory allocation failure. Errors
+ *  other than allocation failures are reported on stderr.
+ */
+int bi_eval(Bigint *r, Bigint *rem, char op, const Bigint *a, const Bigint *b, const Bigint *m)
+{
+	switch (op)
+	{
+		case '+':
+			return bi_add(r, a, b);
+		case '-':
+			return bi_sub(r, a, b);
+		case 'x':
+		case '*':
+			// Equal operands take the squaring kernels, about half the work
+			if (a == b || (a->sign == b->sign && bi_cmp_abs(a, b) == 0))
+				return bi_sqr(r, a);
+			return bi_mul(r, a, b);
+		case '/':
+		case 'd':
+			if (b->len == 0)
+			{
+				fprintf(stderr, "❌ ERROR: Divide by zero !\n");
+				return FAILURE;
+			}
+			return bi_divmod(r, op == 'd' ? rem : NULL, a, b);
+		case '%':
+			if (b->len == 0)
+			{
+				fprintf(stderr, "❌ ERROR: Modulo by zero !\n");
+				return FAILURE;
+			}
+			return bi_mod(r, a, b);
+		case '^':
+			if (m)
+			{
+				if (m->len == 0)
+				{
+					fprintf(stderr, "❌ ERROR: Modulo by zero !\n");
+					return FAILURE;
+				}
+				if (b->sign < 0)
+				{
+					fprintf(stderr, "❌ ERROR: Negative exponent not supported !\n");
+					return FAILURE;
+				}
+				return bi_powmod(r, a, b, m);
+			}
+			if (check_power(a, b) == FAILURE)
+				return FAILURE;
+			return bi_pow(r, a, b);
+		default:
+			fprintf(stderr, "❌ ERROR: Invalid Input :-( Try again...\n");
+			return FAILURE;
+	}
+}
@@ -0,0 +1,112 @@
+/***********************************************************************
+ *  File Name   : karatsuba.c
+ *  Description : Source file for Karatsuba multiplication in the
+ *                Arbitrary Precision Calculator (APC).
+ *                Splits each operand into a high and a low half and
+ *                forms the product from three half-size products
+ *                instead of four, recursing until the operands drop
+ *                below the schoolbook crossover.
+ *
+ *                Functions:
+ *                - limb_mul_karatsuba()
+ *
+ *  Notes       :
+ *  - The crossover is karatsuba_threshold (in limbs). It defaults to
+ *    KARATSUBA_THRESHOLD and can be changed at build time with
+ *    -DKARATSUBA_THRESHOLD=n or at run time by assigning the variable.
+ *  - Unbalanced operands are cut into slices the size of the shorter
+ *    one by limb_mul_sliced(), so every recursive product stays
+ *    balanced.
+ *  - All temporaries live in one scratch buffer allocated per call.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "bigint.h"
+
+size_t karatsuba_threshold = KARATSUBA_THRESHOLD;
+
+static int mul_rec(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, limb_t *ws);
+
+/*
+ * Function: mul_karatsuba
+ * -----------------------
+ * Balanced Karatsuba step for na >= nb > m, where m = ceil(na / 2).
+ *
+ *   a = a1 * B^m + a0,  b = b1 * B^m + b0
+ *   z0 = a0 * b0,  z2 = a1 * b1,  d = (a0 - a1) * (b1 - b0)
+ *   a * b = z2 * B^2m + (z0 + z2 + d) * B^m + z0
+ *
+ * ws must hold 4m limbs plus the scratch of a size-m recursion.
+ */
+static int mul_karatsuba(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, size_t m, limb_t *ws)
+{
+	size_t la1 = na - m, lb1 = nb - m, n = na + nb;
+	limb_t *da = ws, *db = ws + m, *d = ws + 2 * m, *next = ws + 4 * m;
+
+	// |a0 - a1| and |b1 - b0| with their signs
+	int sign = limb_diff(da, a, m, a + m, la1);
+	sign *= -limb_diff(db, b, m, b + m, lb1);
+
+	// d = |a0 - a1| * |b1 - b0|, z0 into the low half of r, z2 into the high half
+	if (mul_rec(d, da, m, db, m, next) == FAILURE || mul_rec(r, a, m, b, m, next) == FAILURE ||
+		mul_rec(r + 2 * m, a + m, la1, b + m, lb1, next) == FAILURE)
+		return FAILURE;
+
+	// Middle term z0 + z2 + d, built in place of d (2m limbs + carry)
+	long carry;
+	if (sign > 0)
+		carry = limb_add_n(d, d, r, 2 * m);
+	else
+		carry = -(long)limb_sub_n(d, r, d, 2 * m);
+	carry += limb_add(d, d, 2 * m, r + 2 * m, n - 2 * m);
+
+	// Middle term is never negative, so carry ends up in 0..2; add it at offset m
+	limb_add(r + m, r + m, n - m, d, 2 * m);
+	if (carry > 0)
+		limb_add_1(r + 3 * m, r + 3 * m, n - 3 * m, (limb_t)carry);
+	return SUCCESS;
+}
+
+/*
+ * Recursive product for na >= nb >= 1, choosing schoolbook, slicing
+ * (limb_mul_sliced(), with ws for the slice products) or a Karatsuba
+ * step by operand size.
+ */
+static int mul_rec(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, limb_t *ws)
+{
+	if (nb < karatsuba_threshold || nb < 2)
+	{
+		limb_mul_basecase(r, a, na, b, nb);
+		return SUCCESS;
+	}
+
+	size_t m = (na + 1) / 2;
+	if (nb <= m)
+		return limb_mul_sliced(r, a, na, b, nb, ws);
+	return mul_karatsuba(r, a, na, b, nb, m, ws);
+}
+
+/*
+ * Function: limb_mul_karatsuba
+ * ----------------------------
+ * Karatsuba product of two limb arrays into na + nb limbs, na >= nb.
+ * r must not overlap a or b.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if a scratch buffer cannot be allocated.
+ */
+int limb_mul_karatsuba(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	/* Each level needs 4 * ceil(n/2) limbs plus the level below: < 4n + 4 log n */
+	limb_t *ws = malloc((4 * na + 4 * 64) * sizeof(limb_t));
+	if (ws == NULL)
+		return FAILURE;
+
+	int status = mul_rec(r, a, na, b, nb, ws);
+	free(ws);
+	return status;
+}
@@ -0,0 +1,349 @@
+/***********************************************************************
+ *  File Name   : libapc.c
+ *  Description : Source file for libapc, the embeddable interface of the
+ *                Arbitrary Precision Calculator (APC).
+ *                An apc_num wraps one Bigint. Each call checks the
+ *                conditions the command line reports on stderr (zero
+ *                divisors, negative exponents, the power limit) and
+ *                returns them as codes, then runs the bi_* operation,
+ *                which on its own can only fail for lack of memory.
+ *
+ *                Functions:
+ *                - apc_new() / apc_free() / apc_copy()
+ *                - apc_parse() / apc_set_i64() / apc_get_i64()
+ *                - apc_format_size() / apc_format()
+ *                - apc_add() / apc_sub() / apc_mul() / apc_sqr()
+ *                - apc_div() / apc_mod() / apc_divmod()
+ *                - apc_pow() / apc_powmod()
+ *                - apc_modulus_new() / apc_modulus_free()
+ *                - apc_reduce() / apc_powmod_ctx()
+ *                - apc_cmp() / apc_sign()
+ *                - apc_strerror()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <errno.h>
+#include "apc.h"
+#include "bigint.h"
+#include "libapc.h"
+
+struct apc_num
+{
+	Bigint v;
+};
+
+struct apc_modulus
+{
+	Bimod ctx;
+};
+
+/*
+ * Return code of a bi_* operation, whose only failure is memory.
+ */
+static int status_code(int status)
+{
+	return status == SUCCESS ? APC_OK : APC_ENOMEM;
+}
+
+/*
+ * Bits per digit of a power-of-two base, 0 for base 10, -1 otherwise.
+ */
+static int base_bits(int base)
+{
+	switch (base)
+	{
+		case 10:
+			return 0;
+		case 16:
+			return 4;
+		case 8:
+			return 3;
+		case 2:
+			return 1;
+		default:
+			return -1;
+	}
+}
+
+apc_num *apc_new(void)
+{
+	apc_num *n = malloc(sizeof(apc_num));
+	if (n)
+		bi_init(&n->v);
+	return n;
+}
+
+void apc_free(apc_num *n)
+{
+	if (n)
+	{
+		bi_free(&n->v);
+		free(n);
+	}
+}
+
+int apc_copy(apc_num *dst, const apc_num *src)
+{
+	return status_code(bi_copy(&dst->v, &src->v));
+}
+
+/*
+ * Function: apc_parse
+ * -------------------
+ * Parses operand text with the syntax of the command line.
+ *
+ * Returns:
+ *  APC_OK, APC_EINVAL for malformed text (n is left unchanged),
+ *  or APC_ENOMEM.
+ */
+int apc_parse(apc_num *n, const char *s, size_t len)
+{
+	// Digits are checked while converting, so parse aside and keep n on
+	// failure; only a failed allocation sets errno to ENOMEM
+	Bigint t;
+	bi_init(&t);
+	errno = 0;
+	int status = bi_from_text(&t, s, len);
+	if (status == SUCCESS)
+		bi_swap(&n->v, &t);
+	bi_free(&t);
+
+	if (status == FAILURE)
+		return errno == ENOMEM ? APC_ENOMEM : APC_EINVAL;
+	return APC_OK;
+}
+
+int apc_set_i64(apc_num *n, int64_t v)
+{
+	// Magnitude in unsigned arithmetic, so INT64_MIN needs no special case
+	uint64_t m = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+
+	if (bi_reserve(&n->v, 2) == FAILURE)
+		return APC_ENOMEM;
+	n->v.limb[0] = (limb_t)m;
+	n->v.limb[1] = (limb_t)(m >> LIMB_BITS);
+	n->v.len = 2;
+	n->v.sign = v < 0 ? -1 : 1;
+	bi_normalize(&n->v);
+	return APC_OK;
+}
+
+int apc_get_i64(const apc_num *n, int64_t *v)
+{
+	if (n->v.len > 2)
+		return APC_ERANGE;
+
+	uint64_t m = 0;
+	for (size_t i = n->v.len; i-- > 0;)
+		m = m << LIMB_BITS | n->v.limb[i];
+
+	// Negative values reach one further: -2^63
+	if (m > (uint64_t)INT64_MAX + (n->v.sign < 0))
+		return APC_ERANGE;
+	*v = n->v.sign < 0 ? (int64_t)(0 - m) : (int64_t)m;
+	return APC_OK;
+}
+
+size_t apc_format_size(const apc_num *n, int base)
+{
+	int bits = base_bits(base);
+	if (bits < 0)
+		return 0;
+
+	// Sign, prefix, digits and NUL
+	return 1 + (bits ? 2 + bi_radix2_bound(&n->v, bits) : bi_digits_bound(&n->v)) + 1;
+}
+
+/*
+ * Function: apc_format
+ * --------------------
+ * Writes n as text that apc_parse() reads back.
+ *
+ * Returns:
+ *  APC_OK, APC_EINVAL for an unsupported base, APC_ENOSPC if size is
+ *  below apc_format_size(), or APC_ENOMEM.
+ */
+int apc_format(const apc_num *n, int base, char *buf, size_t size, size_t *len)
+{
+	int bits = base_bits(base);
+	if (bits < 0)
+		return APC_EINVAL;
+	if (size < apc_format_size(n, base))
+		return APC_ENOSPC;
+
+	char *p = buf;
+	if (n->v.sign < 0)
+		*p++ = '-';
+	if (bits)
+	{
+		*p++ = '0';
+		*p++ = base == 16 ? 'x' : base == 8 ? 'o' : 'b';
+		p += bi_to_radix2(p, &n->v, bits);
+	}
+	else
+	{
+		size_t digits;
+		if (bi_to_digits(p, &digits, &n->v) == FAILURE)
+			return APC_ENOMEM;
+		p += digits;
+	}
+
+	if (len)
+		*len = p - buf;
+	return APC_OK;
+}
+
+int apc_add(apc_num *r, const apc_num *a, const apc_num *b)
+{
+	return status_code(bi_add(&r->v, &a->v, &b->v));
+}
+
+int apc_sub(apc_num *r, const apc_num *a, const apc_num *b)
+{
+	return status_code(bi_sub(&r->v, &a->v, &b->v));
+}
+
+int apc_mul(apc_num *r, const apc_num *a, const apc_num *b)
+{
+	return status_code(bi_mul(&r->v, &a->v, &b->v));
+}
+
+int apc_sqr(apc_num *r, const apc_num *a)
+{
+	return status_code(bi_sqr(&r->v, &a->v));
+}
+
+int apc_div(apc_num *q, const apc_num *a, const apc_num *b)
+{
+	if (b->v.len == 0)
+		return APC_EDIVZERO;
+	return status_code(bi_divmod(&q->v, NULL, &a->v, &b->v));
+}
+
+int apc_mod(apc_num *r, const apc_num *a, const apc_num *b)
+{
+	if (b->v.len == 0)
+		return APC_EDIVZERO;
+	return status_code(bi_mod(&r->v, &a->v, &b->v));
+}
+
+int apc_divmod(apc_num *q, apc_num *r, const apc_num *a, const apc_num *b)
+{
+	if (q == r)
+		return APC_EINVAL;
+	if (b->v.len == 0)
+		return APC_EDIVZERO;
+	return status_code(bi_divmod(&q->v, &r->v, &a->v, &b->v));
+}
+
+/*
+ * Function: apc_pow
+ * -----------------
+ * r = base ^ exp for a non-negative exponent.
+ *
+ * Returns:
+ *  APC_OK, APC_ENEGEXP, APC_ERANGE if the result would exceed
+ *  pow_max_digits decimal digits (checked before any work is done,
+ *  with the bound bi_pow() itself enforces), or APC_ENOMEM.
+ */
+int apc_pow(apc_num *r, const apc_num *base, const apc_num *exp)
+{
+	if (exp->v.sign < 0)
+		return APC_ENEGEXP;
+	if (!bi_pow_fits(&base->v, &exp->v))
+		return APC_ERANGE;
+	return status_code(bi_pow(&r->v, &base->v, &exp->v));
+}
+
+int apc_powmod(apc_num *r, const apc_num *base, const apc_num *exp, const apc_num *m)
+{
+	if (m->v.len == 0)
+		return APC_EDIVZERO;
+	if (exp->v.sign < 0)
+		return APC_ENEGEXP;
+	return status_code(bi_powmod(&r->v, &base->v, &exp->v, &m->v));
+}
+
+/*
+ * Function: apc_modulus_new
+ * -------------------------
+ * Builds a modulus context for |m|, for apc_reduce() and
+ * apc_powmod_ctx(). Setting it up costs about one division.
+ *
+ * Returns:
+ *  APC_OK, APC_EDIVZERO for a zero modulus, or APC_ENOMEM.
+ */
+int apc_modulus_new(apc_modulus **ctx, const apc_num *m)
+{
+	if (m->v.len == 0)
+		return APC_EDIVZERO;
+
+	apc_modulus *c = malloc(sizeof(apc_modulus));
+	if (c == NULL)
+		return APC_ENOMEM;
+	if (bi_mod_init(&c->ctx, &m->v) == FAILURE)
+	{
+		free(c);
+		return APC_ENOMEM;
+	}
+	*ctx = c;
+	return APC_OK;
+}
+
+void apc_modulus_free(apc_modulus *ctx)
+{
+	if (ctx)
+	{
+		bi_mod_free(&ctx->ctx);
+		free(ctx);
+	}
+}
+
+int apc_reduce(apc_num *r, const apc_num *a, const apc_modulus *ctx)
+{
+	return status_code(bi_mod_reduce(&r->v, &a->v, &ctx->ctx));
+}
+
+int apc_powmod_ctx(apc_num *r, const apc_num *base, const apc_num *exp, const apc_modulus *ctx)
+{
+	if (exp->v.sign < 0)
+		return APC_ENEGEXP;
+	return status_code(bi_powmod_ctx(&r->v, &base->v, &exp->v, &ctx->ctx));
+}
+
+int apc_cmp(const apc_num *a, const apc_num *b)
+{
+	int c = bi_cmp(&a->v, &b->v);
+	return (c > 0) - (c < 0);
+}
+
+int apc_sign(const apc_num *n)
+{
+	return n->v.len == 0 ? 0 : n->v.sign;
+}
+
+const char *apc_strerror(int code)
+{
+	switch (code)
+	{
+		case APC_OK:
+			return "success";
+		case APC_ENOMEM:
+			return "out of memory";
+		case APC_EINVAL:
+			return "invalid number or argument";
+		case APC_EDIVZERO:
+			return "division by zero";
+		case APC_ENEGEXP:
+			return "negative exponent";
+		case APC_ERANGE:
+			return "result out of range";
+		case APC_ENOSPC:
+			return "output buffer too small";
+		default:
+			return "unknown error";
+	}
+}
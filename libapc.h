@@ -0,0 +1,143 @@
+/***********************************************************************
+ *  File Name   : libapc.h
+ *  Description : Public interface of libapc, the embeddable form of the
+ *                Arbitrary Precision Calculator (APC).
+ *                Numbers are opaque handles; every call reports errors
+ *                through its return code and never prints, so a service
+ *                can link libapc.a or libapc.so and calculate
+ *                in-process instead of running calc.out per operation.
+ *
+ *                Functions:
+ *                - apc_new() / apc_free() / apc_copy()
+ *                - apc_parse() / apc_set_i64() / apc_get_i64()
+ *                - apc_format_size() / apc_format()
+ *                - apc_add() / apc_sub() / apc_mul() / apc_sqr()
+ *                - apc_div() / apc_mod() / apc_divmod()
+ *                - apc_pow() / apc_powmod()
+ *                - apc_modulus_new() / apc_modulus_free()
+ *                - apc_reduce() / apc_powmod_ctx()
+ *                - apc_cmp() / apc_sign()
+ *                - apc_strerror()
+ *
+ *  Notes:
+ *  - Result arguments may be the same handles as the operands.
+ *  - Division truncates toward zero and the remainder takes the sign of
+ *    the dividend, as on the calc.out command line.
+ *  - Calls on different handles may run on different threads at the
+ *    same time; a handle must not be written by one thread while
+ *    another uses it. A modulus context is never written after it is
+ *    built, so any number of threads may share one.
+ *  - Only the names declared here are part of the interface; neither
+ *    the shared nor the static library defines any other global name.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef LIBAPC_H
+#define LIBAPC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Marks the interface: the library is built with hidden visibility,
+ * so these are the only names libapc.a and libapc.so define globally */
+#if defined(__GNUC__)
+#define APC_API __attribute__((visibility("default")))
+#else
+#define APC_API
+#endif
+
+/* Interface version, bumped on incompatible changes (soname libapc.so.1) */
+#define APC_VERSION 1
+
+/* Return codes: APC_OK, or one of the negative error codes */
+enum
+{
+	APC_OK       =  0,
+	APC_ENOMEM   = -1,   // memory allocation failed
+	APC_EINVAL   = -2,   // malformed number text or invalid argument
+	APC_EDIVZERO = -3,   // division, modulus or modular power by zero
+	APC_ENEGEXP  = -4,   // negative exponent
+	APC_ERANGE   = -5,   // result beyond the power limit or the target type
+	APC_ENOSPC   = -6    // output buffer too small
+};
+
+/* An arbitrary precision signed integer */
+typedef struct apc_num apc_num;
+
+/* Precomputed constants for repeated reduction against one modulus */
+typedef struct apc_modulus apc_modulus;
+
+/* New number with the value zero, or NULL if memory allocation fails */
+APC_API apc_num *apc_new(void);
+
+/* Release a number (NULL is ignored) */
+APC_API void apc_free(apc_num *n);
+
+/* dst = src */
+APC_API int apc_copy(apc_num *dst, const apc_num *src);
+
+/* Parse len characters: optional blanks and sign, an optional 0x / 0o /
+ * 0b prefix, then digits of that base (decimal without one) */
+APC_API int apc_parse(apc_num *n, const char *s, size_t len);
+
+/* Set from, or read into, a 64-bit integer (APC_ERANGE if it does not fit) */
+APC_API int apc_set_i64(apc_num *n, int64_t v);
+APC_API int apc_get_i64(const apc_num *n, int64_t *v);
+
+/* Buffer size, NUL included, that apc_format() needs for n in base
+ * 10, 16, 8 or 2 (0 for any other base) */
+APC_API size_t apc_format_size(const apc_num *n, int base);
+
+/* Write n as NUL terminated text in base 10, 16, 8 or 2, the others
+ * with a 0x / 0o / 0b prefix after the sign; *len (if not NULL) gets
+ * the length without the NUL. size must be at least apc_format_size() */
+APC_API int apc_format(const apc_num *n, int base, char *buf, size_t size, size_t *len);
+
+/* r = a + b, a - b, a * b */
+APC_API int apc_add(apc_num *r, const apc_num *a, const apc_num *b);
+APC_API int apc_sub(apc_num *r, const apc_num *a, const apc_num *b);
+APC_API int apc_mul(apc_num *r, const apc_num *a, const apc_num *b);
+
+/* r = a * a, on squaring kernels that take about half the work of apc_mul() */
+APC_API int apc_sqr(apc_num *r, const apc_num *a);
+
+/* q = a / b, r = a % b, or both at once (q and r distinct) */
+APC_API int apc_div(apc_num *q, const apc_num *a, const apc_num *b);
+APC_API int apc_mod(apc_num *r, const apc_num *a, const apc_num *b);
+APC_API int apc_divmod(apc_num *q, apc_num *r, const apc_num *a, const apc_num *b);
+
+/* r = base ^ exp, and r = base ^ exp mod m */
+APC_API int apc_pow(apc_num *r, const apc_num *base, const apc_num *exp);
+APC_API int apc_powmod(apc_num *r, const apc_num *base, const apc_num *exp, const apc_num *m);
+
+/* Build a context for |m| into *ctx (APC_EDIVZERO for zero), and free one */
+APC_API int apc_modulus_new(apc_modulus **ctx, const apc_num *m);
+APC_API void apc_modulus_free(apc_modulus *ctx);
+
+/* r = a % m with the sign of a, and r = base ^ exp mod |m|, both against
+ * a context: after the first call with a modulus, each costs a few
+ * multiplications instead of a division */
+APC_API int apc_reduce(apc_num *r, const apc_num *a, const apc_modulus *ctx);
+APC_API int apc_powmod_ctx(apc_num *r, const apc_num *base, const apc_num *exp, const apc_modulus *ctx);
+
+/* -1, 0 or 1 as a < b, a == b, a > b */
+APC_API int apc_cmp(const apc_num *a, const apc_num *b);
+
+/* -1, 0 or 1 as n is negative, zero or positive */
+APC_API int apc_sign(const apc_num *n);
+
+/* Static description of a return code */
+APC_API const char *apc_strerror(int code);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBAPC_H */
@@ -10,14 +10,20 @@
  *   - dl_insert_last()      : Insert a node at the end
  *   - dl_delete_first()     : Delete the first node
  *   - dl_delete_list()      : Delete the entire list
- *   - compare_list()        : Compare two numbers
+ *   - compare_list()        : Compare two number handles
  *   - delete_leading_zero() : Remove leading zeroes
  *   - copy_list()           : Duplicate a list
  *   - print_list()          : Print list as number
+ *   - dn_*()                : Number handle helpers (cached length)
+ *   - dl_arena_init()       : Prepare an empty node arena
+ *   - dl_arena_select()     : Switch the arena new nodes come from
+ *   - dl_arena_release()    : Free a whole arena in one go
  *
  *  Notes:
  *   - Each digit of a number is stored in a node (MSD at head, LSD at tail).
  *   - These functions are utility routines that arithmetic modules depend on.
+ *   - Nodes are handed out from large slabs; freed nodes are kept on a
+ *     freelist, so deleting a whole list is a single splice.
  *
  *  Author      : Pankaj Kumar
  *  Roll No     : 25008_018
@@ -26,13 +32,172 @@
 
 #include "list.h"
 
+struct dl_slab
+{
+    struct dl_slab *next;
+    Dlist nodes[DL_SLAB_NODES];
+};
+
+/* Process-wide arena used when no other arena is selected */
+static Darena default_arena;
+static Darena *current_arena = &default_arena;
+
+/*
+ * Hands out one node from the current arena: a recycled node if the
+ * freelist has one, otherwise the next unused node of the newest slab.
+ */
+static Dlist *dl_node_alloc(void)
+{
+    Darena *arena = current_arena;
+
+    // Reuse a recycled node first
+    if (arena->free_list)
+    {
+        Dlist *node = arena->free_list;
+        arena->free_list = node->next;
+        return node;
+    }
+
+    // Start a new slab when the newest one is exhausted
+    if (arena->slabs == NULL || arena->used == DL_SLAB_NODES)
+    {
+        struct dl_slab *slab = malloc(sizeof(struct dl_slab));
+        if (slab == NULL)
+            return NULL;
+        slab->next = arena->slabs;
+        arena->slabs = slab;
+        arena->used = 0;
+    }
+    return &arena->slabs->nodes[arena->used++];
+}
+
+/*
+ * Returns one node to the freelist of the current arena.
+ */
+static void dl_node_free(Dlist *node)
+{
+    node->next = current_arena->free_list;
+    current_arena->free_list = node;
+}
+
+/*
+ * Initialises a number handle to zero (empty list, positive).
+ */
+void dn_init(Dnum *num)
+{
+    num->head = num->tail = NULL;
+    num->len = 0;
+    num->sign = 1;
+}
+
+/*
+ * Inserts a digit at the most significant end of a number.
+ */
+int dn_insert_first(Dnum *num, int data)
+{
+    if (dl_insert_first(&num->head, &num->tail, data) == FAILURE)
+        return FAILURE;
+    num->len++;
+    return SUCCESS;
+}
+
+/*
+ * Inserts a digit at the least significant end of a number.
+ */
+int dn_insert_last(Dnum *num, int data)
+{
+    if (dl_insert_last(&num->head, &num->tail, data) == FAILURE)
+        return FAILURE;
+    num->len++;
+    return SUCCESS;
+}
+
+/*
+ * Deletes the most significant digit of a number.
+ */
+int dn_delete_first(Dnum *num)
+{
+    if (dl_delete_first(&num->head, &num->tail) == FAILURE)
+        return FAILURE;
+    num->len--;
+    return SUCCESS;
+}
+
+/*
+ * Deletes every digit of a number; the handle becomes zero.
+ */
+int dn_delete_list(Dnum *num)
+{
+    int status = dl_delete_list(&num->head, &num->tail);
+    dn_init(num);
+    return status;
+}
+
+/*
+ * Removes leading zeroes from a number. A number trimmed down to
+ * nothing is zero, which is always positive.
+ */
+int dn_delete_leading_zero(Dnum *num)
+{
+    if (num->head == NULL)
+        return FAILURE;
+
+    while (num->head && num->head->data == 0)
+        dn_delete_first(num);
+
+    if (num->len == 0)
+        num->sign = 1;
+    return SUCCESS;
+}
+
+/*
+ * Initialises an arena with no slabs and an empty freelist.
+ */
+void dl_arena_init(Darena *arena)
+{
+    arena->slabs = NULL;
+    arena->used = 0;
+    arena->free_list = NULL;
+}
+
+/*
+ * Makes the given arena (or the default one for NULL) the source of
+ * new nodes and returns the arena that was current before.
+ */
+Darena *dl_arena_select(Darena *arena)
+{
+    Darena *prev = current_arena;
+    current_arena = arena ? arena : &default_arena;
+    return prev;
+}
+
+/*
+ * Function: dl_arena_release
+ * --------------------------
+ * Frees every slab of the arena. All lists built from it become
+ * invalid at once, so temporaries do not need to be deleted one by one.
+ * The arena is left empty and can be reused.
+ */
+void dl_arena_release(Darena *arena)
+{
+    struct dl_slab *slab = arena->slabs;
+
+    while (slab)
+    {
+        struct dl_slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    dl_arena_init(arena);
+}
+
 /* 
  * Inserts a new node at the beginning of the doubly linked list.
  */
 int dl_insert_first(Dlist **head, Dlist **tail, int data)
 {
-    // Allocate memory for new node
-    Dlist *newNode = malloc(sizeof(Dlist));
+    // Take a node from the current arena
+    Dlist *newNode = dl_node_alloc();
     if (newNode == NULL)
         return FAILURE;
 
@@ -59,8 +224,8 @@ int dl_insert_first(Dlist **head, Dlist **tail, int data)
  */
 int dl_insert_last(Dlist **head, Dlist **tail, int data)
 {
-    // Allocate memory for new node
-    Dlist *new = malloc(sizeof(Dlist));
+    // Take a node from the current arena
+    Dlist *new = dl_node_alloc();
     if (new == NULL)
         return FAILURE;
 
@@ -84,22 +249,16 @@ int dl_insert_last(Dlist **head, Dlist **tail, int data)
 
 /* 
  * Deletes all nodes from the doubly linked list.
+ * The nodes are already chained through next, so the whole list is
+ * spliced onto the arena freelist in O(1).
  */
 int dl_delete_list(Dlist **head, Dlist **tail)
 {
     if (*head == NULL)
         return FAILURE;
 
-    Dlist *curr = *head;
-    Dlist *next;
-
-    // Traverse the list and free each node
-    while (curr)
-    {
-        next = curr->next;
-        free(curr);
-        curr = next;
-    }
+    (*tail)->next = current_arena->free_list;
+    current_arena->free_list = *head;
 
     // Reset head and tail
     *head = *tail = NULL;
@@ -117,7 +276,7 @@ int dl_delete_first(Dlist **head, Dlist **tail)
     // If list has only one node
     if (*head == *tail)
     {
-        free(*head);
+        dl_node_free(*head);
         *head = *tail = NULL;
         return SUCCESS;
     }
@@ -126,71 +285,49 @@ int dl_delete_first(Dlist **head, Dlist **tail)
     Dlist *temp = *head;
     *head = (*head)->next;
     (*head)->prev = NULL;
-    free(temp);
+    dl_node_free(temp);
     return SUCCESS;
 }
 
 /* 
  * Function: compare_list
  * ----------------------
- * Compares two doubly linked lists representing numbers.
- * Comparison is done first by length, then digit by digit (MSB to LSB).
+ * Compares the magnitudes of two numbers held in handles.
+ * The cached digit counts decide first; only numbers of equal length
+ * are compared digit by digit (MSB to LSB).
  * 
- * head1 : head of first list
- * head2 : head of second list
+ * num1 : first number
+ * num2 : second number
  *
  * returns: 
- *   1  if list1 > list2
- *  -1  if list1 < list2
- *   0  if both lists are equal
+ *   1  if num1 > num2
+ *  -1  if num1 < num2
+ *   0  if both numbers are equal
  */
-int compare_list(Dlist *head1, Dlist *head2)
+int compare_list(const Dnum *num1, const Dnum *num2)
 {
-    if (head1 == NULL || head2 == NULL)
-        return FAILURE;
-
-    Dlist *temp1 = head1, *temp2 = head2;
-    int list_len1 = 0, list_len2 = 0;
-
-    // Calculate length of list1
-    while (temp1)
-    {
-        temp1 = temp1->next;
-        list_len1++;
-    }
-
-    // Calculate length of list2
-    while (temp2)
-    {
-        temp2 = temp2->next;
-        list_len2++;
-    }
-
     // Compare by length first
-    if (list_len1 > list_len2)
+    if (num1->len > num2->len)
         return 1;
-    else if (list_len1 < list_len2)
+    else if (num1->len < num2->len)
         return -1;
-    else
+
+    // Lengths are equal → compare digit by digit
+    Dlist *temp1 = num1->head, *temp2 = num2->head;
+    while (temp1 && temp2)
     {
-        // Lengths are equal → compare digit by digit
-        temp1 = head1;
-        temp2 = head2;
-        for (int i = 0; i < list_len1; i++)
-        {
-            int digit1 = temp1->data, digit2 = temp2->data;
+        int digit1 = temp1->data, digit2 = temp2->data;
 
-            if (digit1 > digit2)
-                return 1;
-            else if (digit1 < digit2)
-                return -1;
+        if (digit1 > digit2)
+            return 1;
+        else if (digit1 < digit2)
+            return -1;
 
-            // move to next digit
-            temp1 = temp1->next;
-            temp2 = temp2->next;
-        }
+        // move to next digit
+        temp1 = temp1->next;
+        temp2 = temp2->next;
     }
-    return 0; // lists are equal
+    return 0; // numbers are equal
 }
 
 /* 
@@ -233,20 +370,28 @@ int copy_list(Dlist **headR, Dlist **tailR, Dlist *head)
  * --------------------
  * Prints the number stored in the doubly linked list.
  * If list is empty → print "0".
- * Otherwise, prints digits from head to tail.
+ * Otherwise, prints digits from head to tail in blocks.
+ * main() and the batch modes write through the Dwriter in output.c.
  */
 void print_list(Dlist *head)
 {
     if (head == NULL)
     {
         printf("0");
+        return;
     }
-    else
+
+    // Collect digits into a block so stdio sees one call per block
+    char block[4096];
+    size_t n = 0;
+    for (; head; head = head->next)
     {
-        while (head)
+        block[n++] = (char)('0' + head->data);
+        if (n == sizeof block)
         {
-            printf("%d", head->data);
-            head = head->next;
+            fwrite(block, 1, n, stdout);
+            n = 0;
         }
     }
+    fwrite(block, 1, n, stdout);
 }
@@ -10,14 +10,28 @@
  *   - dl_insert_last()    : Insert a node at the end
  *   - dl_delete_first()   : Delete a node from the beginning
  *   - dl_delete_list()    : Delete the entire list
- *   - compare_list()      : Compare two numbers stored as lists
+ *   - compare_list()      : Compare two number handles
  *   - delete_leading_zero(): Remove unnecessary leading zeroes
  *   - copy_list()         : Duplicate a list into another
+ *   - dn_init()           : Prepare an empty number handle
+ *   - dn_insert_first()   : Handle version of dl_insert_first()
+ *   - dn_insert_last()    : Handle version of dl_insert_last()
+ *   - dn_delete_first()   : Handle version of dl_delete_first()
+ *   - dn_delete_list()    : Handle version of dl_delete_list()
+ *   - dn_delete_leading_zero(): Handle version of delete_leading_zero()
+ *   - dl_arena_init()     : Prepare an empty node arena
+ *   - dl_arena_select()   : Make an arena the source of new nodes
+ *   - dl_arena_release()  : Free every node of an arena at once
  *
  *  Notes:
  *  - Each digit of a number is stored in one node.
  *  - Lists represent big integers, with head as MSD and tail as LSD.
  *  - These functions are the building blocks for arithmetic ops.
+ *  - A Dnum handle carries head, tail, digit count and sign; the dn_*
+ *    helpers keep the count current so comparisons rarely need a walk.
+ *  - Nodes come from slabs owned by the current arena instead of one
+ *    malloc() per digit. Deleted nodes go to the arena's freelist, so
+ *    a list must be deleted while the arena it came from is current.
  *
  *  Author      : Pankaj Kumar
  *  Roll No     : 25008_018
@@ -29,6 +43,19 @@
 
 #include "apc.h"
 
+/* Nodes carved out of one slab allocation */
+#define DL_SLAB_NODES 4096
+
+struct dl_slab;
+
+/* Node arena: a chain of slabs plus a freelist of recycled nodes */
+typedef struct
+{
+    struct dl_slab *slabs;   // newest slab first
+    size_t used;             // nodes handed out from the newest slab
+    Dlist *free_list;        // recycled nodes chained through next
+} Darena;
+
 /* Insert a node at the beginning */
 int dl_insert_first(Dlist **head, Dlist **tail, int data);
 
@@ -41,8 +68,8 @@ int dl_delete_first(Dlist **head, Dlist **tail);
 /* Delete the entire list */
 int dl_delete_list(Dlist **head, Dlist **tail);
 
-/* Compare two lists (numbers) */
-int compare_list(Dlist *head1, Dlist *head2);
+/* Compare the magnitudes of two numbers */
+int compare_list(const Dnum *num1, const Dnum *num2);
 
 /* Delete the leading zeroes */
 int delete_leading_zero(Dlist **head, Dlist **tail);
@@ -50,4 +77,23 @@ int delete_leading_zero(Dlist **head, Dlist **tail);
 /* Copy the list to another list */
 int copy_list(Dlist **headR, Dlist **tailR, Dlist * head);
 
+/* Prepare an empty number handle (value zero) */
+void dn_init(Dnum *num);
+
+/* Handle helpers that keep the digit count up to date */
+int dn_insert_first(Dnum *num, int data);
+int dn_insert_last(Dnum *num, int data);
+int dn_delete_first(Dnum *num);
+int dn_delete_list(Dnum *num);
+int dn_delete_leading_zero(Dnum *num);
+
+/* Prepare an empty arena */
+void dl_arena_init(Darena *arena);
+
+/* Make an arena current for node allocation, returns the previous one */
+Darena *dl_arena_select(Darena *arena);
+
+/* Free all slabs of an arena, releasing every list built from it */
+void dl_arena_release(Darena *arena);
+
 #endif /* LIST_H */
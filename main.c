@@ -8,21 +8,185 @@
  *
  *                Functions:
  *                - main()
+ *                - open_output() / write_header()
+ *                - close_operands() / operand_to_bigint()
+ *                - run_bigint()
  *
  *  Author      : Pankaj Kumar
  *  Roll No     : 25008_018
  *  Date        : 07-Sep-2025
  ***********************************************************************/
 
+#include <unistd.h>
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
+#include "output.h"
+
+/* Results go through one buffered writer (too large for the stack) */
+static Dwriter writer;
+
+/* Output options from the command line */
+typedef struct
+{
+	int raw;            // --raw: no framing
+	int binary;         // --binary: binary records instead of text
+	int base;           // --base: 10, 16, 8 or 2
+	const char *path;   // -o: output file, or NULL for stdout
+	int threads;        // --threads: batch workers, 0 for one per core
+} Outopts;
+
+/*
+ * Opens the stream results go to: the file named with -o, or stdout.
+ */
+static FILE *open_output(const char *path)
+{
+	if (path == NULL)
+		return stdout;
+
+	FILE *out = fopen(path, "w");
+	if (out == NULL)
+		fprintf(stderr, "❌ ERROR: Cannot open '%s'\n", path);
+	return out;
+}
+
+/*
+ * Writes the framing above the result: operands and operator.
+ */
+static void write_header(Dwriter *w, char **argv, int modpow)
+{
+	dw_printf(w, "------------------------------\n");
+	dw_printf(w, "Input:    %s\n", argv[1]);
+	dw_printf(w, "Operator: %c\n", argv[2][0]);
+	dw_printf(w, "Input:    %s\n", argv[3]);
+	if (modpow)
+		dw_printf(w, "Modulus:  %s\n", argv[5]);
+	dw_printf(w, "------------------------------\n");
+}
+
+/*
+ * Releases the text of the first n operands.
+ */
+static void close_operands(Dsrc *src, int n)
+{
+	for (int i = 0; i < n; i++)
+		operand_close(&src[i]);
+}
+
+/*
+ * Loads one operand as a Bigint: a binary record is used in place
+ * where possible (*view set), text of any base is parsed.
+ */
+static int operand_to_bigint(Bigint *a, int *view, const Dsrc *src)
+{
+	*view = 0;
+	if (operand_radix(src) == 0)
+		return bi_view_record(a, src->text, src->len, view);
+	return bi_from_text(a, src->text, src->len);
+}
+
+/*
+ * Function: run_bigint
+ * --------------------
+ * Runs one calculation on Bigints. Used when an operand is hex, octal,
+ * binary text or a binary record, or comes from a file or stdin, or
+ * when the result is wanted in another base or as a binary record
+ * (--binary), so those numbers never go through a decimal conversion
+ * or a digit list. A binary result for
+ * 'd' is two records: the quotient, then the remainder.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on an invalid operand, a failed operation or a
+ *  failed write.
+ */
+static int run_bigint(char **argv, const Dsrc *src, int modpow, const Outopts *opt)
+{
+	Bigint x[3], r, rem;
+	int view[3] = { 0, 0, 0 };
+	char op = argv[2][0];
+
+	for (int i = 0; i < 3; i++)
+		bi_init(&x[i]);
+	bi_init(&r);
+	bi_init(&rem);
+
+	int status = FAILURE;
+	int pow10 = 0, sign = 1;   // result is ±10^zeros, written without being built
+	size_t zeros = 0;
+	if (operand_to_bigint(&x[0], &view[0], &src[0]) == FAILURE || operand_to_bigint(&x[1], &view[1], &src[1]) == FAILURE ||
+		(modpow && operand_to_bigint(&x[2], &view[2], &src[2]) == FAILURE))
+		fprintf(stderr, "❌ Error: Invalid Operand :-( Try again...\n");
+	else if (op == '^' && !modpow && !opt->binary && opt->base == 10 && bi_pow10_zeros(&x[0], &x[1], &zeros, &sign))
+	{
+		pow10 = 1;
+		status = SUCCESS;
+	}
+	else if (bi_eval(&r, &rem, op, &x[0], &x[1], modpow ? &x[2] : NULL) == FAILURE)
+		fprintf(stderr, "❌ ERROR: Operation failed.\n");
+	else
+		status = SUCCESS;
+
+	FILE *out = NULL;
+	if (status == SUCCESS && (out = open_output(opt->path)) == NULL)
+		status = FAILURE;
+
+	if (status == SUCCESS && opt->binary)
+	{
+		if (bi_save(&r, out) == FAILURE || (op == 'd' && bi_save(&rem, out) == FAILURE) || fflush(out) != 0)
+			status = FAILURE;
+	}
+	else if (status == SUCCESS)
+	{
+		dw_init(&writer, out);
+		if (!opt->raw)
+		{
+			write_header(&writer, argv, modpow);
+			dw_str(&writer, op == 'd' ? "Quotient:  " : "Result:   ");
+		}
+		if (pow10)
+		{
+			if (sign < 0)
+				dw_str(&writer, "-");
+			dw_pow10(&writer, zeros);
+		}
+		else
+			dw_bigint_base(&writer, &r, opt->base);
+		dw_str(&writer, "\n");
+		if (op == 'd')
+		{
+			if (!opt->raw)
+				dw_str(&writer, "Remainder: ");
+			dw_bigint_base(&writer, &rem, opt->base);
+			dw_str(&writer, "\n");
+		}
+		if (!opt->raw)
+			dw_str(&writer, "------------------------------\n");
+		status = dw_flush(&writer);
+	}
+
+	if (out && out != stdout && fclose(out) != 0)
+		status = FAILURE;
+	if (out && status == FAILURE)
+		fprintf(stderr, "❌ ERROR: Cannot write the result\n");
+
+	// Views point into the operand text and own no storage
+	for (int i = 0; i < 3; i++)
+	{
+		if (view[i])
+			bi_init(&x[i]);
+		bi_free(&x[i]);
+	}
+	bi_free(&r);
+	bi_free(&rem);
+	return status;
+}
 
 int main(int argc, char **argv)
 {
 	/* Declare doubly linked list pointers for operands and result */
-	Dlist *head1 = NULL, *tail1 = NULL;   // Operand1
-	Dlist *head2 = NULL, *tail2 = NULL;   // Operand2
+	Dnum num1, num2, num3;                // Operand1, Operand2, modulus of modpow
 	Dlist *headR = NULL, *tailR = NULL;   // Result
+	Dlist *headM = NULL, *tailM = NULL;   // Remainder of divmod
 
 	// Check if minimum required arguments are passed
     if (argc < 2)
@@ -37,93 +201,274 @@ int main(int argc, char **argv)
 			"Arbitrary Precision Calculator (APC)\n"
 			"-------------------------------------\n"
 			"Usage:\n"
-			"  ./a.out <operand1> <operator> <operand2>\n"
+			"  ./a.out [options] <operand1> <operator> <operand2>\n"
+			"  ./a.out [options] <base> ^ <exponent> mod <modulus>\n"
+			"  ./a.out [options] --mod <divisor> [file]   (one dividend per line, stdin by default)\n"
+			"  ./a.out [options] --batch [file]           (one '<a> <op> <b>' per line, stdin by default)\n"
+			"\n"
+			"Options:\n"
+			"  --raw         print only the result, without the framing\n"
+			"  --binary      write the result as a binary record (two for d)\n"
+			"  --base <n>    write the result in base 10, 16, 8 or 2\n"
+			"  -o <file>     write the output to a file instead of stdout\n"
+			"  --threads <n> worker threads for --batch (default: one per core)\n"
+			"\n"
+			"Operands:\n"
+			"  digits with an optional sign and 0x / 0o / 0b prefix,\n"
+			"  '@file' to read one from a file\n"
+			"  (decimal, or a binary record written with --binary),\n"
+			"  or '@-' to read one from stdin\n"
 			"\n"
 			"Operators:\n"
 			"  +   Addition\n"
 			"  -   Subtraction\n"
-			"  *   Multiplication\n"
+			"  x   Multiplication (or *)\n"
 			"  /   Division\n"
 			"  %%   Modulus\n"
+			"  d   Divmod (quotient and remainder)\n"
 			"  ^   Power\n"
 			"\n"
 			"Examples:\n"
 			"  ./a.out 12345678901234567890 + 98765432109876543210\n"
 			"  ./a.out 55555 * 99999\n"
+			"  ./a.out @big.txt x @-  < other.txt\n"
 			"\n");
 		return SUCCESS; /* Exit after printing help */
 	}
 
-	/* Check for valid syntax: needs exactly 3 arguments */
-	if (argc != 4)
+	/* Output options come first: --raw drops the framing, --binary writes
+	 * binary records, --base picks the output base, -o <file> redirects
+	 * the output, --threads sizes the --batch worker pool */
+	Outopts opt = { 0, 0, 10, NULL, 0 };
+	for (;;)
+	{
+		if (argc > 1 && strcmp(argv[1], "--raw") == 0)
+			opt.raw = 1;
+		else if (argc > 1 && strcmp(argv[1], "--binary") == 0)
+			opt.binary = 1;
+		else if (argc > 2 && (strcmp(argv[1], "-o") == 0 || strcmp(argv[1], "--output") == 0))
+		{
+			opt.path = argv[2];
+			argv++;
+			argc--;
+		}
+		else if (argc > 2 && strcmp(argv[1], "--base") == 0)
+		{
+			opt.base = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		else if (argc > 2 && strcmp(argv[1], "--threads") == 0)
+		{
+			opt.threads = atoi(argv[2]);
+			argv++;
+			argc--;
+		}
+		else
+			break;
+		argv++;
+		argc--;
+	}
+	if (opt.base != 10 && opt.base != 16 && opt.base != 8 && opt.base != 2)
+	{
+		fprintf(stderr, "❌ ERROR: Output base must be 10, 16, 8 or 2\n");
+		return FAILURE;
+	}
+	if (opt.threads < 0)
+	{
+		fprintf(stderr, "❌ ERROR: Thread count must not be negative\n");
+		return FAILURE;
+	}
+	if (opt.threads == 0)
+	{
+		long cores = sysconf(_SC_NPROCESSORS_ONLN);
+		opt.threads = cores > 0 ? (int)cores : 1;
+	}
+	if (argc < 2)
 	{
 		fprintf(stderr, "❌ ERROR: Invalid Syntax :-( Try again...\n");
 		return FAILURE;
 	}
 
-	/* Validate that both operands contain only digits */
-	if (validate_input_args(argv) == FAILURE)
+	/* Batch modes: dividends for a fixed divisor (--mod), or whole
+	 * operations (--batch), one per line from a file or stdin */
+	int mod = strcmp(argv[1], "--mod") == 0;
+	if (mod || strcmp(argv[1], "--batch") == 0)
 	{
-		fprintf(stderr, "❌ Error: Invalid Operand :-( Try again...\n");
+		int file = mod ? 3 : 2;   // index of the optional input file
+		if (argc != file && argc != file + 1)
+		{
+			fprintf(stderr, "❌ ERROR: Invalid Syntax :-( Try again...\n");
+			return FAILURE;
+		}
+
+		FILE *in = stdin;
+		if (argc == file + 1 && (in = fopen(argv[file], "r")) == NULL)
+		{
+			fprintf(stderr, "❌ ERROR: Cannot open '%s'\n", argv[file]);
+			return FAILURE;
+		}
+		FILE *out = open_output(opt.path);
+		if (out == NULL)
+		{
+			if (in != stdin)
+				fclose(in);
+			return FAILURE;
+		}
+
+		dw_init(&writer, out);
+		int status = mod ? batch_mod(argv[2], in, &writer, opt.base) : batch_eval(in, &writer, opt.base, opt.threads);
+		if (dw_flush(&writer) == FAILURE)
+			status = FAILURE;
+		if (in != stdin)
+			fclose(in);
+		if (out != stdout && fclose(out) != 0)
+			status = FAILURE;
+		return status;
+	}
+
+	/* Modular power takes a third operand: <base> ^ <exponent> mod <modulus> */
+	int modpow = (argc == 6 && strcmp(argv[2], "^") == 0 && strcmp(argv[4], "mod") == 0);
+
+	/* Check for valid syntax: needs exactly 3 arguments */
+	if (argc != 4 && !modpow)
+	{
+		fprintf(stderr, "❌ ERROR: Invalid Syntax :-( Try again...\n");
 		return FAILURE;
 	}
 
 	/* Validate operator (must be a single character) */
 	if (strlen(argv[2]) > 1)
 	{
-        printf("❌ Error: Invalid operator '%s'\nAllowed: + - x / %% ^\n", argv[2]);
+        printf("❌ Error: Invalid operator '%s'\nAllowed: + - x * / %% d ^\n", argv[2]);
 		return FAILURE;
 	}
 
-	/* Convert input string digits into doubly linked lists */
-	digit_to_list(&head1, &tail1, &head2, &tail2, argv);
+	/* Read each operand's text once: the argument itself, a file or stdin */
+	const char *args[3] = { argv[1], argv[3], modpow ? argv[5] : NULL };
+	int nops = modpow ? 3 : 2;
+	Dsrc src[3];
+	for (int i = 0; i < nops; i++)
+	{
+		if (operand_open(&src[i], args[i]) == FAILURE)
+		{
+			close_operands(src, i);
+			fprintf(stderr, "❌ Error: Invalid Operand :-( Try again...\n");
+			return FAILURE;
+		}
+	}
+
+	/* Other bases, binary records, a non-decimal result or any operand
+	 * read from a file or stdin skip the digit lists altogether: those
+	 * are parsed in place, a node per digit is only worth it for the
+	 * short operands typed as arguments */
+	int bigint = opt.binary || opt.base != 10;
+	for (int i = 0; i < nops; i++)
+		if (operand_radix(&src[i]) != 10 || src[i].map || src[i].buf)
+			bigint = 1;
+	if (bigint)
+	{
+		int status = run_bigint(argv, src, modpow, &opt);
+		close_operands(src, nops);
+		return status;
+	}
+
+	/* All lists of this calculation come from one arena */
+	Darena arena;
+	dl_arena_init(&arena);
+	dl_arena_select(&arena);
+
+	/* Validate the operands and convert their digits into doubly linked lists in one pass */
+	int valid = src_to_num(&num1, &src[0]) == SUCCESS && src_to_num(&num2, &src[1]) == SUCCESS &&
+		(!modpow || src_to_num(&num3, &src[2]) == SUCCESS);
+	close_operands(src, nops);
+	if (!valid)
+	{
+		fprintf(stderr, "❌ Error: Invalid Operand :-( Try again...\n");
+		dl_arena_select(NULL);
+		dl_arena_release(&arena);
+		return FAILURE;
+	}
 
 	/* Perform operation based on operator */
-	delete_leading_zero(&head1, &tail1);
-	delete_leading_zero(&head2, &tail2);
+	dn_delete_leading_zero(&num1);
+	dn_delete_leading_zero(&num2);
+	if (modpow)
+		dn_delete_leading_zero(&num3);
 
 	/* Extract operator */
 	int sign_flag = 1;
 
 	/* check operation type and also update sign flag based on operationa and operands */
-	char operator = check_operation_type(argv, head1, head2, &sign_flag);
+	char operator = check_operation_type(argv[2][0], &num1, &num2, &sign_flag);
 	int status = FAILURE;  // store operation result status
 	int sub_flag = 1;          // used for subtraction sign handling
+	int pow10 = 0;             // result is 10^zeros, written without a list
+	size_t zeros = 0;
 
 	switch (operator)
 	{
 		case '+':
 			/* Perform addition */
-			status = addition(&head1, &tail1, &head2, &tail2, &headR, &tailR);
+			status = addition(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR);
 			break;
 		case '-':
 			/* Perform subtraction (requires operand comparison for sign) */
-			sub_flag = compare_list(head1, head2);
+			sub_flag = compare_list(&num1, &num2);
 			if (sub_flag == 1) // Operand1 >= Operand2
-				status = subtraction(&head1, &tail1, &head2, &tail2, &headR, &tailR);
+				status = subtraction(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR);
 			else if (sub_flag == -1) // Operand2 > Operand1 → result negative
-				status = subtraction(&head2, &tail2, &head1, &tail1, &headR, &tailR);
+				status = subtraction(&num2.head, &num2.tail, &num1.head, &num1.tail, &headR, &tailR);
 			else
 				status = SUCCESS;
 			break;
-		case 'x': // (you can also use '*' if implemented that way)
+		case 'x': // check_operation_type() maps '*' to 'x'
+			/* Equal magnitudes are squared, about half the work; sign_flag already holds the sign */
+			if (compare_list(&num1, &num2) == 0)
+			{
+				status = square(&num1.head, &num1.tail, &headR, &tailR);
+				break;
+			}
 			/* Perform multiplication */
-			status = multiplication(&head1, &tail1, &head2, &tail2, &headR, &tailR);
+			status = multiplication(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR);
 			break;
 		case '/':
 			/* Perform division */
-			status = division(&head1, &tail1, &head2, &tail2, &headR, &tailR);
+			status = division(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR);
+			break;
+		case 'd':
+			/* Quotient and remainder from one division */
+			status = divmod(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR, &headM, &tailM);
 			break;
 		case '%':
 			/* Perform modulo */
-			status = modulus(&head1, &tail1, &head2, &tail2, &headR, &tailR);
+			status = modulus(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR);
 			break;
 		case '^':
+			if (modpow)
+			{
+				/* Modular power: the residue is never negative */
+				sign_flag = 1;
+				if (num2.sign < 0 && num2.head)
+				{
+					fprintf(stderr, "❌ ERROR: Negative exponent not supported !\n");
+					break;
+				}
+				status = power_mod(&num1, &num2, &num3, &headR, &tailR);
+				break;
+			}
 			/* Perform power */
 			/* check for valid exponent */
-			if(check_exponent(argv[3])  == FAILURE)
+			if(check_exponent(&num1, &num2)  == FAILURE)
 				break;
-			status = power(&head1, &tail1, &head2, &tail2, &headR, &tailR);
+			/* A power of ten is written out directly, never built */
+			pow10 = power_of_ten(num1.head, num2.head, &zeros);
+			if (pow10)
+			{
+				status = SUCCESS;
+				break;
+			}
+			status = power(&num1.head, &num1.tail, &num2.head, &num2.tail, &headR, &tailR);
 			break;
 		default:
 
@@ -133,28 +478,51 @@ int main(int argc, char **argv)
 	}
 
 	if (status == FAILURE)
-    {
-        fprintf(stderr, "❌ ERROR: Operation failed.\n");
-        return FAILURE;
-    }
+	{
+		fprintf(stderr, "❌ ERROR: Operation failed.\n");
+		return FAILURE;
+	}
+
+	/* ---------- OUTPUT SECTION ---------- */
+	FILE *out = open_output(opt.path);
+	if (out == NULL)
+		return FAILURE;
+	dw_init(&writer, out);
+
+	if (!opt.raw)
+	{
+		write_header(&writer, argv, modpow);
+		dw_str(&writer, operator == 'd' ? "Quotient:  " : "Result:   ");
+	}
+
+	if (sign_flag == -1 && (headR || pow10))
+		dw_str(&writer, "-");
+	if (pow10)
+		dw_pow10(&writer, zeros);
+	else
+		dw_list(&writer, headR);
+	dw_str(&writer, "\n");
+	if (operator == 'd')
+	{
+		/* Remainder takes the dividend's sign */
+		if (!opt.raw)
+			dw_str(&writer, "Remainder: ");
+		if (num1.sign < 0 && headM)
+			dw_str(&writer, "-");
+		dw_list(&writer, headM);
+		dw_str(&writer, "\n");
+	}
+	if (!opt.raw)
+		dw_str(&writer, "------------------------------\n");
+
+	status = dw_flush(&writer);
+	if (out != stdout && fclose(out) != 0)
+		status = FAILURE;
+	if (status == FAILURE)
+		fprintf(stderr, "❌ ERROR: Cannot write the result\n");
 
-    /* ---------- OUTPUT SECTION ---------- */
-    printf("------------------------------\n");
-    printf("Input:    %s\n", argv[1]);
-    printf("Operator: %c\n", argv[2][0]);
-    printf("Input:    %s\n", argv[3]);
-    printf("------------------------------\n");
-
-    printf("Result:   ");
-    if (sign_flag == -1)
-        printf("-");
-    print_list(headR);
-    printf("\n");
-    printf("------------------------------\n");
-
-	/* Free memory for all lists */
-	dl_delete_list(&head1, &tail1);
-	dl_delete_list(&head2, &tail2);
-	dl_delete_list(&headR, &tailR);
-	return 0;
+	/* Free memory for all lists by releasing their arena */
+	dl_arena_select(NULL);
+	dl_arena_release(&arena);
+	return status;
 }
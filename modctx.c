@@ -0,0 +1,388 @@
+/***********************************************************************
+ *  File Name   : modctx.c
+ *  Description : Source file for reusable modulus contexts in the
+ *                Arbitrary Precision Calculator (APC).
+ *                A context takes one modulus and precomputes what
+ *                repeated reductions against it need: the Barrett
+ *                constant for reducing arbitrary values, and for odd
+ *                moduli the Montgomery constants for chains of modular
+ *                multiplications. After that every reduction costs a
+ *                few multiplications instead of a long division.
+ *
+ *                Functions:
+ *                - bi_mod_init() / bi_mod_free()
+ *                - bi_mod_reduce() / bi_mod_mul()
+ *                - bi_mont_in() / bi_mont_out() / bi_mont_mul()
+ *
+ *  Notes       :
+ *  - With n the limb count of the modulus m, B = 2^32 and R = B^n:
+ *      mu = B^2n / m    (Barrett)
+ *      r2 = B^2n mod m  (R^2 mod m, to enter Montgomery form)
+ *    both come out of one division when the context is set up.
+ *  - Below barrett_threshold limbs the two Barrett products are short
+ *    schoolbook products that skip the limbs the reduction throws
+ *    away; above it they are full products from limb_mul().
+ *  - The context is read-only after bi_mod_init(), so one context can
+ *    be shared by any number of callers; scratch space is per call.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "bigint.h"
+
+size_t barrett_threshold = BARRETT_THRESHOLD;
+
+/*
+ * Function: bi_mod_init
+ * ---------------------
+ * Sets up a modulus context for |m|.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if m is zero or memory allocation fails.
+ */
+int bi_mod_init(Bimod *ctx, const Bigint *m)
+{
+	bi_init(&ctx->m);
+	bi_init(&ctx->mu);
+	bi_init(&ctx->r2);
+	ctx->n = m->len;
+	ctx->odd = 0;
+	ctx->minv = 0;
+
+	if (m->len == 0)
+		return FAILURE;
+
+	size_t n = m->len;
+	limb_t *pw = calloc(2 * n + 1, sizeof(limb_t));
+	if (pw == NULL)
+		return FAILURE;
+	pw[2 * n] = 1;
+
+	// mu and r2 are the quotient and remainder of B^2n / m
+	int status = FAILURE;
+	if (bi_copy(&ctx->m, m) == SUCCESS && bi_reserve(&ctx->mu, n + 2) == SUCCESS &&
+		bi_reserve(&ctx->r2, n) == SUCCESS &&
+		limb_divrem(ctx->mu.limb, ctx->r2.limb, pw, 2 * n + 1, m->limb, n) == SUCCESS)
+		status = SUCCESS;
+	free(pw);
+
+	if (status == FAILURE)
+	{
+		bi_mod_free(ctx);
+		return FAILURE;
+	}
+
+	ctx->m.sign = 1;
+	ctx->mu.len = n + 2;
+	ctx->r2.len = n;
+	bi_normalize(&ctx->mu);
+	bi_normalize(&ctx->r2);
+
+	// Montgomery needs m odd: Newton iteration for m^-1 mod B, then negate
+	if (m->limb[0] & 1)
+	{
+		limb_t inv = m->limb[0];
+		for (int k = 0; k < 5; k++)
+			inv *= 2 - m->limb[0] * inv;
+		ctx->minv = -inv;
+		ctx->odd = 1;
+	}
+	return SUCCESS;
+}
+
+/*
+ * Releases the storage of a modulus context.
+ */
+void bi_mod_free(Bimod *ctx)
+{
+	bi_free(&ctx->m);
+	bi_free(&ctx->mu);
+	bi_free(&ctx->r2);
+	ctx->n = 0;
+	ctx->odd = 0;
+}
+
+/*
+ * Short products for small moduli, where skipping limb products pays
+ * off directly. Each leaves r[0 .. na+nb) with the wanted limbs
+ * set and the others possibly inexact.
+ */
+
+/* Low w limbs of a * b (limbs at w and above are left out) */
+static void mul_low(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, size_t w)
+{
+	memset(r, 0, w * sizeof(limb_t));
+	for (size_t i = 0; i < na && i < w; i++)
+	{
+		size_t k = w - i < nb ? w - i : nb;
+		limb_t c = limb_addmul_1(r + i, b, k, a[i]);
+		if (i + k < w)
+			r[i + k] = c;
+	}
+}
+
+/*
+ * Limbs from position lo up of a * b, with every limb product below
+ * position lo - 2 left out. The dropped part is below (na + nb) B^(lo-1),
+ * so for lo >= 2 the result from position lo is at most one too small.
+ */
+static void mul_high(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, size_t lo)
+{
+	size_t skip = lo >= 2 ? lo - 2 : 0;
+
+	memset(r, 0, (na + nb) * sizeof(limb_t));
+	for (size_t i = 0; i < na; i++)
+	{
+		size_t j = skip > i ? skip - i : 0;
+		if (j < nb)
+			r[i + nb] = limb_addmul_1(r + i + j, b + j, nb - j, a[i]);
+	}
+}
+
+/*
+ * Function: barrett
+ * -----------------
+ * Barrett reduction (HAC 14.42) of x, xn <= 2n limbs, into r[0 .. n):
+ *   q = ((x / B^(n-1)) * mu) / B^(n+1)  is at most 2 below x / m
+ *   r = x - q * m, computed modulo B^(n+1), then at most two
+ *       subtractions of m (three when q comes from mul_high())
+ * tp is scratch of 5n + 8 limbs.
+ */
+static void barrett(limb_t *r, const limb_t *x, size_t xn, const Bimod *ctx, limb_t *tp)
+{
+	size_t n = ctx->n, w = n + 1;
+	const limb_t *m = ctx->m.limb;
+
+	// Values below B^(n-1) are already reduced
+	if (xn < n)
+	{
+		memcpy(r, x, xn * sizeof(limb_t));
+		memset(r + xn, 0, (n - xn) * sizeof(limb_t));
+		return;
+	}
+
+	limb_t *rr = tp, *q2 = tp + w;
+
+	// rr = x mod B^(n+1)
+	size_t low = xn < w ? xn : w;
+	memcpy(rr, x, low * sizeof(limb_t));
+	memset(rr + low, 0, (w - low) * sizeof(limb_t));
+
+	// Small moduli only form the limbs of each product that are used
+	int shortmul = n < barrett_threshold;
+
+	// q2 = (x / B^(n-1)) * mu, q3 = q2 / B^(n+1)
+	size_t q1n = xn - (n - 1), q2n = q1n + ctx->mu.len;
+	if (shortmul)
+		mul_high(q2, x + n - 1, q1n, ctx->mu.limb, ctx->mu.len, w);
+	else
+		limb_mul(q2, x + n - 1, q1n, ctx->mu.limb, ctx->mu.len);
+
+	if (q2n > w)
+	{
+		// rr -= q3 * m modulo B^(n+1); only the low n + 1 limbs matter
+		const limb_t *q3 = q2 + w;
+		size_t q3n = q2n - w;
+		limb_t *p = q2 + q2n;
+
+		if (shortmul)
+			mul_low(p, q3, q3n, m, n, w);
+		else
+		{
+			limb_mul(p, q3, q3n, m, n);
+			if (q3n + n < w)
+				memset(p + q3n + n, 0, (w - q3n - n) * sizeof(limb_t));
+		}
+		limb_sub_n(rr, rr, p, w);
+	}
+
+	// A few more multiples of m are left (at most three with short products)
+	while (rr[n] || limb_cmp(rr, m, n) >= 0)
+		limb_sub(rr, rr, w, m, n);
+
+	memcpy(r, rr, n * sizeof(limb_t));
+}
+
+/*
+ * Function: bi_mod_reduce
+ * -----------------------
+ * Reduces a value against the context: r = a mod m, with the sign of
+ * the dividend like bi_mod(). Values up to 2n limbs take one Barrett
+ * step; longer ones are folded in n limbs at a time from the top.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int bi_mod_reduce(Bigint *r, const Bigint *a, const Bimod *ctx)
+{
+	size_t n = ctx->n;
+
+	// Already below the modulus
+	if (bi_cmp_abs(a, &ctx->m) < 0)
+		return bi_copy(r, a);
+
+	// out: n limbs, win: 2n limb window, then the Barrett scratch
+	limb_t *out = malloc((8 * n + 8) * sizeof(limb_t));
+	if (out == NULL)
+		return FAILURE;
+	limb_t *win = out + n, *tp = win + 2 * n;
+
+	if (a->len <= 2 * n)
+		barrett(out, a->limb, a->len, ctx, tp);
+	else
+	{
+		// Top partial block first, then out * B^n + next block each step
+		size_t pos = a->len - (a->len % n ? a->len % n : n);
+		barrett(out, a->limb + pos, a->len - pos, ctx, tp);
+		while (pos > 0)
+		{
+			pos -= n;
+			memcpy(win, a->limb + pos, n * sizeof(limb_t));
+			memcpy(win + n, out, n * sizeof(limb_t));
+			barrett(out, win, 2 * n, ctx, tp);
+		}
+	}
+
+	// a is no longer read, so r may alias it
+	int sign = a->sign;
+	if (bi_reserve(r, n) == FAILURE)
+	{
+		free(out);
+		return FAILURE;
+	}
+	memcpy(r->limb, out, n * sizeof(limb_t));
+	r->len = n;
+	r->sign = sign;
+	bi_normalize(r);
+
+	free(out);
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_mod_mul
+ * --------------------
+ * Modular product r = a * b mod m for 0 <= a, b < m: one multiplication
+ * and one Barrett step.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int bi_mod_mul(Bigint *r, const Bigint *a, const Bigint *b, const Bimod *ctx)
+{
+	if (a == b)
+	{
+		if (bi_sqr(r, a) == FAILURE)
+			return FAILURE;
+	}
+	else if (bi_mul(r, a, b) == FAILURE)
+		return FAILURE;
+
+	return bi_mod_reduce(r, r, ctx);
+}
+
+/*
+ * Montgomery reduction: r[0 .. n) = t * R^-1 mod m for t < m * R.
+ * t holds 2n + 1 limbs and is overwritten.
+ */
+static void redc(limb_t *r, limb_t *t, const Bimod *ctx)
+{
+	size_t n = ctx->n;
+	const limb_t *m = ctx->m.limb;
+
+	// Clear one low limb per step by adding a multiple of m
+	t[2 * n] = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		limb_t u = t[i] * ctx->minv;
+		limb_t c = limb_addmul_1(t + i, m, n, u);
+		limb_add_1(t + i + n, t + i + n, n + 1 - i, c);
+	}
+
+	// t / R is below 2m
+	if (t[2 * n] || limb_cmp(t + n, m, n) >= 0)
+		limb_sub_n(r, t + n, m, n);
+	else
+		memcpy(r, t + n, n * sizeof(limb_t));
+}
+
+/*
+ * Function: bi_mont_mul
+ * ---------------------
+ * Montgomery product r = a * b * R^-1 mod m for 0 <= a, b < m.
+ * With a and b in Montgomery form (x R mod m) the result is too.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if m is even or memory allocation fails.
+ */
+int bi_mont_mul(Bigint *r, const Bigint *a, const Bigint *b, const Bimod *ctx)
+{
+	if (!ctx->odd)
+		return FAILURE;
+	if (a->len == 0 || b->len == 0)
+		return bi_set_u32(r, 0);
+
+	size_t n = ctx->n;
+	limb_t *t = malloc((3 * n + 1) * sizeof(limb_t));
+	if (t == NULL)
+		return FAILURE;
+	limb_t *out = t + 2 * n + 1;
+
+	// Product into the low limbs, zero up to the 2n + 1 REDC needs
+	size_t pn = a->len + b->len;
+	if (limb_mul(t, a->limb, a->len, b->limb, b->len) == FAILURE)
+	{
+		free(t);
+		return FAILURE;
+	}
+	memset(t + pn, 0, (2 * n + 1 - pn) * sizeof(limb_t));
+	redc(out, t, ctx);
+
+	if (bi_reserve(r, n) == FAILURE)
+	{
+		free(t);
+		return FAILURE;
+	}
+	memcpy(r->limb, out, n * sizeof(limb_t));
+	r->len = n;
+	r->sign = 1;
+	bi_normalize(r);
+
+	free(t);
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_mont_in
+ * --------------------
+ * Converts 0 <= a < m into Montgomery form: r = a * R mod m.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if m is even or memory allocation fails.
+ */
+int bi_mont_in(Bigint *r, const Bigint *a, const Bimod *ctx)
+{
+	return bi_mont_mul(r, a, &ctx->r2, ctx);
+}
+
+/*
+ * Function: bi_mont_out
+ * ---------------------
+ * Converts out of Montgomery form: r = a * R^-1 mod m for 0 <= a < m.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if m is even or memory allocation fails.
+ */
+int bi_mont_out(Bigint *r, const Bigint *a, const Bimod *ctx)
+{
+	Bigint one;
+	limb_t limb = 1;
+
+	one.limb = &limb;
+	one.len = one.cap = 1;
+	one.sign = 1;
+	return bi_mont_mul(r, a, &one, ctx);
+}
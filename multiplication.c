@@ -2,11 +2,18 @@
  *  File Name   : multiplication.c
  *  Description : Source file for multiplication operation in the 
  *                Arbitrary Precision Calculator (APC).
- *                Implements digit-by-digit multiplication 
+ *                Implements limb-by-limb multiplication 
  *                with support for large numbers stored as 
- *                doubly linked lists.
+ *                Bigint limb arrays, plus the list-based entry point.
  *
  *                Functions:
+ *                - limb_mul_1()
+ *                - limb_addmul_1()
+ *                - limb_submul_1()
+ *                - limb_mul_basecase()
+ *                - limb_mul_sliced()
+ *                - limb_mul()
+ *                - bi_mul()
  *                - multiplication()
  *
  *  Author      : Pankaj Kumar
@@ -16,6 +23,225 @@
 
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
+
+/*
+ * Function: limb_mul_1
+ * --------------------
+ * Multiplies n limbs by a single limb: r = a * b.
+ *
+ * Returns:
+ *  the carry limb out of the top position
+ */
+limb_t limb_mul_1(limb_t *r, const limb_t *a, size_t n, limb_t b)
+{
+	dlimb_t carry = 0;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		dlimb_t mul = (dlimb_t)a[i] * b + carry;
+		r[i] = (limb_t)mul;
+		carry = mul >> LIMB_BITS;
+	}
+	return (limb_t)carry;
+}
+
+/*
+ * Function: limb_addmul_1
+ * -----------------------
+ * Adds n limbs times a single limb onto r: r += a * b.
+ * This is one row of the schoolbook product.
+ *
+ * Returns:
+ *  the carry limb out of the top position
+ */
+limb_t limb_addmul_1(limb_t *r, const limb_t *a, size_t n, limb_t b)
+{
+	dlimb_t carry = 0;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		dlimb_t mul = (dlimb_t)a[i] * b + r[i] + carry;
+		r[i] = (limb_t)mul;
+		carry = mul >> LIMB_BITS;
+	}
+	return (limb_t)carry;
+}
+
+/*
+ * Function: limb_submul_1
+ * -----------------------
+ * Subtracts n limbs times a single limb from r: r -= a * b.
+ * This is the multiply-and-subtract step of long division.
+ *
+ * Returns:
+ *  the limb still to be subtracted from the position above r
+ */
+limb_t limb_submul_1(limb_t *r, const limb_t *a, size_t n, limb_t b)
+{
+	dlimb_t borrow = 0;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		dlimb_t mul = (dlimb_t)a[i] * b + borrow;
+		limb_t lo = (limb_t)mul;
+		borrow = (mul >> LIMB_BITS) + (r[i] < lo);
+		r[i] -= lo;
+	}
+	return (limb_t)borrow;
+}
+
+/*
+ * Function: limb_mul_basecase
+ * ---------------------------
+ * Schoolbook product of two limb arrays into one preallocated buffer
+ * of exactly na + nb limbs. The first row initialises the buffer, every
+ * further row is accumulated in place and its carry stored once at the
+ * top, so there are no temporaries and no separate addition passes.
+ *
+ * r must not overlap a or b.
+ */
+void limb_mul_basecase(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	/* First row writes the buffer directly */
+	r[na] = limb_mul_1(r, a, na, b[0]);
+
+	/* Remaining rows accumulate at their place value */
+	for (size_t j = 1; j < nb; j++)
+		r[na + j] = limb_addmul_1(r + j, a, na, b[j]);
+}
+
+/*
+ * Function: limb_mul_sliced
+ * -------------------------
+ * Product of a long operand by a shorter one (na >= nb): a is cut into
+ * nb-limb slices so each product is balanced and goes through
+ * limb_mul() on the fastest tier for its size, and the slice products
+ * are added at their offsets. ws holds one slice product (2 * nb
+ * limbs). r must not overlap a, b or ws.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if a slice product cannot get scratch memory.
+ */
+int limb_mul_sliced(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb, limb_t *ws)
+{
+	// First slice initialises r[0 .. 2nb)
+	int status = limb_mul(r, a, nb, b, nb);
+
+	for (size_t done = nb; done < na && status == SUCCESS; done += nb)
+	{
+		size_t piece = na - done < nb ? na - done : nb;
+
+		// Slice product goes to ws[0 .. piece + nb)
+		status = limb_mul(ws, b, nb, a + done, piece);
+
+		// Low nb limbs overlap what is already in r, the rest is new
+		limb_t carry = limb_add_n(r + done, r + done, ws, nb);
+		limb_add_1(r + done + nb, ws + nb, piece, carry);
+	}
+	return status;
+}
+
+/*
+ * Function: limb_mul
+ * ------------------
+ * Product of two limb arrays: r[0 .. na+nb) = a * b.
+ * This is the dispatch point for the multiplication algorithms,
+ * chosen by the size of the shorter operand (squares of one array
+ * are handed to limb_sqr()):
+ *   schoolbook    below karatsuba_threshold limbs
+ *   Karatsuba     below toom3_threshold limbs
+ *   Toom-3        below ntt_threshold limbs, once roughly balanced
+ *   NTT           above that, up to NTT_MAX_LEN limbs of product
+ * r must not overlap a or b and both lengths must be non-zero.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if scratch memory cannot be allocated.
+ */
+int limb_mul(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	/* Squares have their own kernels */
+	if (a == b && na == nb)
+		return limb_sqr(r, a, na);
+
+	/* Keep the longer operand first */
+	if (na < nb)
+	{
+		const limb_t *t = a;
+		a = b;
+		b = t;
+		size_t n = na;
+		na = nb;
+		nb = n;
+	}
+
+	if (nb < karatsuba_threshold)
+	{
+		limb_mul_basecase(r, a, na, b, nb);
+		return SUCCESS;
+	}
+	if (nb < toom3_threshold)
+		return limb_mul_karatsuba(r, a, na, b, nb);
+	if (nb >= ntt_threshold && na + nb <= NTT_MAX_LEN)
+		return limb_mul_ntt(r, a, na, b, nb);
+
+	/* Toom-3 needs three non-empty parts in both operands */
+	if (nb > 2 * ((na + 2) / 3))
+		return limb_mul_toom3(r, a, na, b, nb);
+	if (na > nb)
+	{
+		limb_t *ws = malloc(2 * nb * sizeof(limb_t));
+		if (ws == NULL)
+			return FAILURE;
+		int status = limb_mul_sliced(r, a, na, b, nb, ws);
+		free(ws);
+		return status;
+	}
+	return limb_mul_karatsuba(r, a, na, b, nb);
+}
+
+/*
+ * Function: bi_mul
+ * ----------------
+ * Multiplies two Bigints: r = a * b.
+ * The product has at most len1 + len2 limbs, so it is sized once
+ * up front and filled by limb_mul().
+ *
+ * Returns:
+ *  SUCCESS if multiplication succeeds,
+ *  FAILURE if memory allocation fails.
+ */
+int bi_mul(Bigint *r, const Bigint *a, const Bigint *b)
+{
+	/* If either number is zero, the product is zero */
+	if (a->len == 0 || b->len == 0)
+		return bi_set_u32(r, 0);
+
+	/* Product goes straight into r's storage, or into a separate buffer
+	 * when r aliases a or b */
+	Bigint t, *p = r;
+	bi_init(&t);
+	if (bi_alias(r, a) || bi_alias(r, b))
+		p = &t;
+	if (bi_reserve(p, a->len + b->len) == FAILURE)
+		return FAILURE;
+
+	int sign = a->sign * b->sign;
+	if (limb_mul(p->limb, a->limb, a->len, b->limb, b->len) == FAILURE)
+	{
+		bi_free(&t);
+		return FAILURE;
+	}
+
+	p->len = a->len + b->len;
+	p->sign = sign;
+	bi_normalize(p);
+
+	if (p == &t)
+		bi_swap(r, &t);
+	bi_free(&t);
+	return SUCCESS;
+}
 
 /*
  * Function: multiplication
@@ -30,84 +256,26 @@
  *
  * Returns:
  *  SUCCESS if multiplication succeeds,
- *  FAILURE if either list is empty.
+ *  FAILURE if memory allocation fails.
  */
 int multiplication(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
 {
-
 	/* If either number is empty, Return SUCCESS with empty headR*/
 	if (*head1 == NULL || *head2 == NULL)
 		return SUCCESS;
 
-	/*
-	 * temp1 -> used to iterate through first number
-	 * temp2 -> used to iterate through second number
-	 */
-	Dlist *temp1 = *tail1, *temp2 = *tail2;
+	Bigint a, b, r;
+	bi_init(&a);
+	bi_init(&b);
+	bi_init(&r);
 
-	/* Temporary result lists for partial products and intermediate sums */
-	Dlist *headR1, *tailR1, *headR2, *tailR2;
-	headR1 = tailR1 = headR2 = tailR2 = NULL;
+	int status = FAILURE;
+	if (bi_from_list(&a, *head1) == SUCCESS && bi_from_list(&b, *head2) == SUCCESS &&
+		bi_mul(&r, &a, &b) == SUCCESS)
+		status = bi_to_list(headR, tailR, &r);
 
-	int count = 0; // keeps track of how many zeros to pad (place value)
-
-	/* Outer loop: iterate through digits of second number (multiplier) */
-	while (temp2)
-	{
-		int carry = 0;
-
-		/* Add zero padding at beginning of partial product (for place value) */
-		for (int i = 0; i < count; i++)
-		{
-			dl_insert_first(&headR1, &tailR1, 0);
-		}
-
-		/* Inner loop: multiply current digit of second number with all digits of first number */
-		while (temp1)
-		{
-			int mul = (temp1->data) * (temp2->data) + carry;
-			carry = mul / 10;
-
-			/* If last digit of multiplier, add directly into final result */
-			if (temp2->next == NULL)
-				dl_insert_first(headR, tailR, mul % 10);
-			else
-				dl_insert_first(&headR1, &tailR1, mul % 10);
-
-			temp1 = temp1->prev;
-		}
-
-		/* If carry remains after finishing inner loop */
-		if (carry)
-		{
-			if (temp2->next == NULL)
-				dl_insert_first(headR, tailR, carry);
-			else
-				dl_insert_first(&headR1, &tailR1, carry);
-		}
-
-		/* If we already have a result, add partial product to it */
-		if (count > 0)
-		{
-			addition(headR, tailR, &headR1, &tailR1, &headR2, &tailR2);
-
-			/* Free old lists and update result */
-			dl_delete_list(headR, tailR);
-			dl_delete_list(&headR1, &tailR1);
-
-			*headR = headR2;
-			*tailR = tailR2;
-
-			headR1 = tailR1 = NULL;
-			headR2 = tailR2 = NULL;
-		}
-
-		/* Move to previous digit of multiplier */
-		temp2 = temp2->prev;
-		temp1 = *tail1; // Reset temp1 for next iteration
-		count++;
-	}
-
-	delete_leading_zero(headR, tailR);
-	return SUCCESS;
-}
\ No newline at end of file
+	bi_free(&a);
+	bi_free(&b);
+	bi_free(&r);
+	return status;
+}
@@ -0,0 +1,274 @@
+/***********************************************************************
+ *  File Name   : ntt.c
+ *  Description : Source file for number-theoretic transform (NTT)
+ *                multiplication in the Arbitrary Precision
+ *                Calculator (APC).
+ *                The limbs of both operands are treated as polynomial
+ *                coefficients, convolved modulo three word-sized NTT
+ *                primes, and the exact coefficients are rebuilt with
+ *                the Chinese remainder theorem before carrying them
+ *                into base 2^32 limbs.
+ *
+ *                Functions:
+ *                - limb_mul_ntt()
+ *
+ *  Notes       :
+ *  - Each convolution coefficient is below min(na, nb) * 2^64, and the
+ *    three primes multiply to about 2^89, so products of up to
+ *    NTT_MAX_LEN limbs come out exact.
+ *  - Arithmetic modulo each prime runs in Montgomery form (R = 2^32).
+ *  - The forward transform is decimation-in-frequency and the inverse
+ *    is decimation-in-time, so no bit-reversal pass is needed.
+ *  - Squaring (same array passed twice) transforms the operand once.
+ *  - The crossover is ntt_threshold (in limbs), tunable like the
+ *    Karatsuba and Toom-3 thresholds.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "bigint.h"
+
+size_t ntt_threshold = NTT_THRESHOLD;
+
+/* One NTT prime p = c * 2^k + 1 with its Montgomery constants */
+typedef struct
+{
+	uint32_t p;      // the prime
+	uint32_t g;      // primitive root modulo p
+	uint32_t pinv;   // -p^-1 mod 2^32
+	uint32_t r2;     // 2^64 mod p
+} Prime;
+
+/* Primes and primitive roots; their product is about 2^89 */
+static const uint32_t prime_table[3][2] = {
+	{ 2013265921u, 31 },   // 15 * 2^27 + 1
+	{ 469762049u,   3 },   //  7 * 2^26 + 1
+	{ 754974721u,  11 },   // 45 * 2^24 + 1
+};
+
+/*
+ * Montgomery reduction: returns t / 2^32 mod p for t < p * 2^32.
+ */
+static inline uint32_t redc(uint64_t t, const Prime *q)
+{
+	uint32_t m = (uint32_t)t * q->pinv;
+	uint64_t u = (t + (uint64_t)m * q->p) >> 32;
+	return u >= q->p ? (uint32_t)(u - q->p) : (uint32_t)u;
+}
+
+static inline uint32_t mmul(uint32_t a, uint32_t b, const Prime *q)
+{
+	return redc((uint64_t)a * b, q);
+}
+
+static inline uint32_t madd(uint32_t a, uint32_t b, const Prime *q)
+{
+	uint32_t s = a + b;
+	return s >= q->p ? s - q->p : s;
+}
+
+static inline uint32_t msub(uint32_t a, uint32_t b, const Prime *q)
+{
+	return a >= b ? a - b : a + q->p - b;
+}
+
+/*
+ * Plain modular exponentiation, used only for setup constants.
+ */
+static uint32_t pow_mod(uint64_t b, uint64_t e, uint32_t p)
+{
+	uint64_t r = 1;
+
+	b %= p;
+	while (e)
+	{
+		if (e & 1)
+			r = r * b % p;
+		b = b * b % p;
+		e >>= 1;
+	}
+	return (uint32_t)r;
+}
+
+/*
+ * Fills in a prime and its Montgomery constants.
+ */
+static void prime_init(Prime *q, uint32_t p, uint32_t g)
+{
+	q->p = p;
+	q->g = g;
+
+	// Newton iteration for p^-1 mod 2^32, then negate
+	uint32_t inv = p;
+	for (int k = 0; k < 5; k++)
+		inv *= 2 - p * inv;
+	q->pinv = -inv;
+
+	uint64_t r = ((uint64_t)1 << 32) % p;
+	q->r2 = (uint32_t)(r * r % p);
+}
+
+/* Converts any 32-bit value into Montgomery form (x * r2 < p * 2^32) */
+static inline uint32_t to_mont(uint32_t x, const Prime *q)
+{
+	return mmul(x, q->r2, q);
+}
+
+/*
+ * Builds the twiddle table for length n: w[h + j] = W_2h^j for every
+ * level h = 1, 2, 4 ... n/2, in Montgomery form. With inverse set the
+ * inverse roots are stored instead.
+ */
+static void make_roots(uint32_t *w, size_t n, int inverse, const Prime *q)
+{
+	uint32_t root = pow_mod(q->g, (q->p - 1) / n, q->p);
+	if (inverse)
+		root = pow_mod(root, q->p - 2, q->p);
+
+	// Top level directly, lower levels take every second root
+	size_t h = n / 2;
+	uint32_t step = to_mont(root, q), cur = to_mont(1, q);
+	for (size_t j = 0; j < h; j++)
+	{
+		w[h + j] = cur;
+		cur = mmul(cur, step, q);
+	}
+	for (h /= 2; h >= 1; h /= 2)
+		for (size_t j = 0; j < h; j++)
+			w[h + j] = w[2 * h + 2 * j];
+}
+
+/*
+ * Forward transform (decimation in frequency), natural order in,
+ * bit-reversed order out.
+ */
+static void ntt_forward(uint32_t *a, size_t n, const uint32_t *w, const Prime *q)
+{
+	for (size_t h = n / 2; h >= 1; h /= 2)
+		for (size_t s = 0; s < n; s += 2 * h)
+			for (size_t j = 0; j < h; j++)
+			{
+				uint32_t u = a[s + j], v = a[s + j + h];
+				a[s + j] = madd(u, v, q);
+				a[s + j + h] = mmul(msub(u, v, q), w[h + j], q);
+			}
+}
+
+/*
+ * Inverse transform (decimation in time), bit-reversed order in,
+ * natural order out. The 1/n factor is applied by the caller.
+ */
+static void ntt_inverse(uint32_t *a, size_t n, const uint32_t *w, const Prime *q)
+{
+	for (size_t h = 1; h < n; h *= 2)
+		for (size_t s = 0; s < n; s += 2 * h)
+			for (size_t j = 0; j < h; j++)
+			{
+				uint32_t u = a[s + j], v = mmul(a[s + j + h], w[h + j], q);
+				a[s + j] = madd(u, v, q);
+				a[s + j + h] = msub(u, v, q);
+			}
+}
+
+/*
+ * Cyclic convolution of a and b modulo one prime; the n coefficients
+ * of the result are left in out, in plain (non-Montgomery) form.
+ * fb and w are scratch arrays of n limbs.
+ */
+static void convolve(uint32_t *out, uint32_t *fb, uint32_t *w, size_t n,
+					 const limb_t *a, size_t na, const limb_t *b, size_t nb, const Prime *q)
+{
+	int square = (a == b && na == nb);
+
+	for (size_t i = 0; i < n; i++)
+		out[i] = i < na ? to_mont(a[i], q) : 0;
+
+	make_roots(w, n, 0, q);
+	ntt_forward(out, n, w, q);
+
+	if (square)
+	{
+		for (size_t i = 0; i < n; i++)
+			out[i] = mmul(out[i], out[i], q);
+	}
+	else
+	{
+		for (size_t i = 0; i < n; i++)
+			fb[i] = i < nb ? to_mont(b[i], q) : 0;
+		ntt_forward(fb, n, w, q);
+		for (size_t i = 0; i < n; i++)
+			out[i] = mmul(out[i], fb[i], q);
+	}
+
+	make_roots(w, n, 1, q);
+	ntt_inverse(out, n, w, q);
+
+	// Scale by 1/n; a plain multiplier under redc also leaves Montgomery form
+	uint32_t n_inv = pow_mod(n % q->p, q->p - 2, q->p);
+	for (size_t i = 0; i < n; i++)
+		out[i] = mmul(out[i], n_inv, q);
+}
+
+/*
+ * Function: limb_mul_ntt
+ * ----------------------
+ * NTT product of two limb arrays into na + nb limbs.
+ * Needs na + nb <= NTT_MAX_LEN. r must not overlap a or b; a and b
+ * may be the same array, which is then transformed only once.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int limb_mul_ntt(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	size_t n = 1, len = na + nb;
+	while (n < len)
+		n *= 2;
+
+	uint32_t *buf = malloc(5 * n * sizeof(uint32_t));
+	if (buf == NULL)
+		return FAILURE;
+
+	uint32_t *res[3] = { buf, buf + n, buf + 2 * n };
+	uint32_t *fb = buf + 3 * n, *w = buf + 4 * n;
+
+	Prime primes[3];
+	for (int i = 0; i < 3; i++)
+	{
+		prime_init(&primes[i], prime_table[i][0], prime_table[i][1]);
+		convolve(res[i], fb, w, n, a, na, b, nb, &primes[i]);
+	}
+
+	// Garner constants for x = v1 + p1 * (v2 + p2 * v3), in Montgomery form
+	const Prime *q2 = &primes[1], *q3 = &primes[2];
+	uint32_t p1 = primes[0].p, p2 = q2->p, p3 = q3->p;
+	uint32_t inv_p1_2 = to_mont(pow_mod(p1, p2 - 2, p2), q2);
+	uint32_t inv_p1_3 = to_mont(pow_mod(p1, p3 - 2, p3), q3);
+	uint32_t inv_p2_3 = to_mont(pow_mod(p2, p3 - 2, p3), q3);
+
+	uint64_t carry = 0;
+	for (size_t i = 0; i < len; i++)
+	{
+		// v1 < p1 < 5 p2 < 3 p3 keeps every difference positive and below 2^32
+		uint32_t v1 = res[0][i];
+		uint32_t v2 = mmul(res[1][i] + 5 * p2 - v1, inv_p1_2, q2);
+		uint32_t v3 = mmul(res[2][i] + 3 * p3 - v1, inv_p1_3, q3);
+		v3 = mmul(v3 + p3 - v2, inv_p2_3, q3);
+
+		// x = v1 + p1 * t, t = v2 + p2 * v3 < 2^62, split into 32-bit halves
+		uint64_t t = v2 + (uint64_t)p2 * v3;
+		uint64_t lo = (uint64_t)p1 * (uint32_t)t + v1;
+		uint64_t hi = (uint64_t)p1 * (t >> 32) + (lo >> 32);
+
+		// Add x into the running carry and emit one limb
+		uint64_t s = (uint64_t)(uint32_t)lo + (uint32_t)carry;
+		r[i] = (limb_t)s;
+		carry = (carry >> 32) + hi + (s >> 32);
+	}
+
+	free(buf);
+	return SUCCESS;
+}
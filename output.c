@@ -0,0 +1,251 @@
+/***********************************************************************
+ *  File Name   : output.c
+ *  Description : Source file for the buffered output writer of the
+ *                Arbitrary Precision Calculator (APC).
+ *                Digits are copied into a 64 KB buffer one byte per
+ *                node, or rendered nine per limb pass straight from a
+ *                Bigint, and the buffer is written out whole, so a
+ *                10M-digit result costs a few hundred fwrite() calls.
+ *
+ *                Functions:
+ *                - dw_init() / dw_flush()
+ *                - dw_str() / dw_bytes() / dw_printf()
+ *                - dw_list() / dw_pow10()
+ *                - dw_bigint() / dw_bigint_base()
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <stdarg.h>
+#include "apc.h"
+#include "bigint.h"
+#include "output.h"
+
+/*
+ * Writes n bytes to the stream, recording a failure in the writer.
+ */
+static int dw_write(Dwriter *w, const char *p, size_t n)
+{
+	if (w->status == SUCCESS && n && fwrite(p, 1, n, w->out) != n)
+		w->status = FAILURE;
+	return w->status;
+}
+
+/*
+ * Empties the buffer into the stream.
+ */
+static int dw_drain(Dwriter *w)
+{
+	dw_write(w, w->buf, w->len);
+	w->len = 0;
+	return w->status;
+}
+
+/*
+ * Appends n bytes, draining the buffer when it fills. Blocks larger
+ * than the buffer skip it and go to the stream in one call.
+ */
+static int dw_append(Dwriter *w, const char *p, size_t n)
+{
+	if (w->len + n > DW_BUF_SIZE && dw_drain(w) == FAILURE)
+		return FAILURE;
+	if (n > DW_BUF_SIZE)
+		return dw_write(w, p, n);
+
+	memcpy(w->buf + w->len, p, n);
+	w->len += n;
+	return w->status;
+}
+
+/*
+ * Attaches a writer to a stream with an empty buffer.
+ */
+void dw_init(Dwriter *w, FILE *out)
+{
+	w->out = out;
+	w->len = 0;
+	w->status = SUCCESS;
+}
+
+/*
+ * Function: dw_flush
+ * ------------------
+ * Writes out everything buffered so far and flushes the stream.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if any write through this writer failed.
+ */
+int dw_flush(Dwriter *w)
+{
+	if (dw_drain(w) == SUCCESS && fflush(w->out) != 0)
+		w->status = FAILURE;
+	return w->status;
+}
+
+/*
+ * Appends a NUL terminated string.
+ */
+int dw_str(Dwriter *w, const char *s)
+{
+	return dw_append(w, s, strlen(s));
+}
+
+/*
+ * Appends n bytes of already formatted text.
+ */
+int dw_bytes(Dwriter *w, const char *p, size_t n)
+{
+	return dw_append(w, p, n);
+}
+
+/*
+ * Appends printf-style formatted text; for the short framing lines,
+ * numbers go through dw_list() or dw_bigint().
+ */
+int dw_printf(Dwriter *w, const char *fmt, ...)
+{
+	char line[256];
+	va_list ap;
+
+	va_start(ap, fmt);
+	int n = vsnprintf(line, sizeof line, fmt, ap);
+	va_end(ap);
+
+	if (n < 0)
+		return w->status = FAILURE;
+	if ((size_t)n < sizeof line)
+		return dw_append(w, line, n);
+
+	// Too long for the line buffer: format again into a heap block
+	char *big = malloc((size_t)n + 1);
+	if (big == NULL)
+		return w->status = FAILURE;
+	va_start(ap, fmt);
+	vsnprintf(big, (size_t)n + 1, fmt, ap);
+	va_end(ap);
+	dw_append(w, big, n);
+	free(big);
+	return w->status;
+}
+
+/*
+ * Function: dw_list
+ * -----------------
+ * Appends the number stored in a digit list, MSD first.
+ * An empty list is written as "0", as print_list() does.
+ */
+int dw_list(Dwriter *w, const Dlist *head)
+{
+	if (head == NULL)
+		return dw_append(w, "0", 1);
+
+	for (; head && w->status == SUCCESS; head = head->next)
+	{
+		if (w->len == DW_BUF_SIZE)
+			dw_drain(w);
+		w->buf[w->len++] = (char)('0' + head->data);
+	}
+	return w->status;
+}
+
+/*
+ * Function: dw_pow10
+ * ------------------
+ * Appends 10^zeros, a one followed by zeros zeroes, filling the buffer
+ * a block at a time, so a power of ten of any size is written without
+ * being built.
+ */
+int dw_pow10(Dwriter *w, size_t zeros)
+{
+	if (dw_append(w, "1", 1) == FAILURE)
+		return FAILURE;
+
+	while (zeros > 0 && w->status == SUCCESS)
+	{
+		if (w->len == DW_BUF_SIZE)
+			dw_drain(w);
+		size_t n = DW_BUF_SIZE - w->len < zeros ? DW_BUF_SIZE - w->len : zeros;
+		memset(w->buf + w->len, '0', n);
+		w->len += n;
+		zeros -= n;
+	}
+	return w->status;
+}
+
+/*
+ * Function: dw_bigint
+ * -------------------
+ * Appends a Bigint in decimal, with a leading '-' when negative.
+ * Short numbers are rendered straight into the buffer; longer ones
+ * into one heap block that goes to the stream in a single write.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on a write or memory allocation failure.
+ */
+int dw_bigint(Dwriter *w, const Bigint *a)
+{
+	if (a->sign < 0 && dw_append(w, "-", 1) == FAILURE)
+		return FAILURE;
+
+	size_t bound = bi_digits_bound(a) + 1, n;
+	if (bound > DW_BUF_SIZE)
+	{
+		char *digits = malloc(bound);
+		if (digits == NULL)
+			return w->status = FAILURE;
+		if (bi_to_digits(digits, &n, a) == FAILURE)
+			w->status = FAILURE;
+		else
+			dw_append(w, digits, n);
+		free(digits);
+		return w->status;
+	}
+
+	if (w->len + bound > DW_BUF_SIZE && dw_drain(w) == FAILURE)
+		return FAILURE;
+	if (bi_to_digits(w->buf + w->len, &n, a) == FAILURE)
+		return w->status = FAILURE;
+	w->len += n;
+	return w->status;
+}
+
+/*
+ * Function: dw_bigint_base
+ * ------------------------
+ * Appends a Bigint in base 10, 16, 8 or 2. The power-of-two bases are
+ * sliced straight out of the limbs in linear time and carry a "0x",
+ * "0o" or "0b" prefix after the sign, so the text reads back as an
+ * operand.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on a write or memory allocation failure.
+ */
+int dw_bigint_base(Dwriter *w, const Bigint *a, int base)
+{
+	unsigned bits = base == 16 ? 4 : base == 8 ? 3 : base == 2 ? 1 : 0;
+	if (bits == 0)
+		return dw_bigint(w, a);
+
+	if (a->sign < 0 && dw_append(w, "-", 1) == FAILURE)
+		return FAILURE;
+	if (dw_str(w, base == 16 ? "0x" : base == 8 ? "0o" : "0b") == FAILURE)
+		return FAILURE;
+
+	size_t bound = bi_radix2_bound(a, bits) + 1;
+	if (bound > DW_BUF_SIZE)
+	{
+		char *digits = malloc(bound);
+		if (digits == NULL)
+			return w->status = FAILURE;
+		dw_append(w, digits, bi_to_radix2(digits, a, bits));
+		free(digits);
+		return w->status;
+	}
+
+	if (w->len + bound > DW_BUF_SIZE && dw_drain(w) == FAILURE)
+		return FAILURE;
+	w->len += bi_to_radix2(w->buf + w->len, a, bits);
+	return w->status;
+}
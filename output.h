@@ -0,0 +1,65 @@
+/***********************************************************************
+ *  File Name   : output.h
+ *  Description : Header file for the buffered output writer of the
+ *                Arbitrary Precision Calculator (APC).
+ *                Numbers and text are rendered into one large buffer
+ *                that goes out in a few fwrite() calls, instead of one
+ *                formatted libc call per digit.
+ *
+ *                Functions:
+ *                - dw_init() / dw_flush()
+ *                - dw_str() / dw_bytes() / dw_printf()
+ *                - dw_list() / dw_pow10()
+ *                - dw_bigint() / dw_bigint_base()
+ *
+ *  Notes:
+ *  - Errors are sticky: after a failed write every later call is a
+ *    no-op, and dw_flush() reports the failure once at the end.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include "apc.h"
+#include "bigint.h"
+
+/* Bytes collected before the writer hands them to the stream */
+#define DW_BUF_SIZE 65536
+
+/* Buffered writer on top of a stdio stream (typedef in apc.h) */
+struct Dwriter
+{
+	FILE *out;               // destination stream
+	size_t len;              // bytes waiting in buf
+	int status;              // SUCCESS, or FAILURE after a failed write
+	char buf[DW_BUF_SIZE];
+};
+
+/* Attach a writer to a stream */
+void dw_init(Dwriter *w, FILE *out);
+
+/* Hand the buffered bytes to the stream and flush it */
+int dw_flush(Dwriter *w);
+
+/* Append text */
+int dw_str(Dwriter *w, const char *s);
+int dw_bytes(Dwriter *w, const char *p, size_t n);
+int dw_printf(Dwriter *w, const char *fmt, ...);
+
+/* Append a digit list ("0" when empty) */
+int dw_list(Dwriter *w, const Dlist *head);
+
+/* Append 10^zeros: a one followed by zeros zeroes */
+int dw_pow10(Dwriter *w, size_t zeros);
+
+/* Append a Bigint in decimal, with a '-' when negative */
+int dw_bigint(Dwriter *w, const Bigint *a);
+
+/* Append a Bigint in base 10, 16, 8 or 2 (prefixed 0x / 0o / 0b) */
+int dw_bigint_base(Dwriter *w, const Bigint *a, int base);
+
+#endif /* OUTPUT_H */
@@ -6,13 +6,17 @@
  *                to another large integer exponent.
  *
  *                Functions:
- *                - power()
+ *                - bi_pow_fits() / bi_pow10_zeros() / bi_pow()
+ *                - power_of_ten() / power()
  *
  *  Notes       :
- *  - Implements fast exponentiation using the 
- *    "exponentiation by squaring" algorithm.
- *  - Recursively divides the exponent by 2 and combines results.
- *  - Uses multiplication and division as helper operations.
+ *  - Implements iterative left-to-right binary exponentiation on
+ *    the bits of the exponent, which is converted to binary once.
+ *  - The result buffers are sized once from exp * log2|base| and
+ *    reused for every step.
+ *  - Results larger than pow_max_digits digits are refused; the
+ *    limit defaults to POW_MAX_DIGITS.
+ *  - Works on Bigint limb arrays; power() converts the digit lists.
  *  - Exponent must be non-negative.
  *
  *  Author      : Pankaj Kumar
@@ -20,91 +24,339 @@
  *  Date        : 07-Sep-2025
  ***********************************************************************/
 
+#include <math.h>
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
+
+size_t pow_max_digits = POW_MAX_DIGITS;
 
 /*
- * Function: power
+ * log2 of a non-zero magnitude from its top two limbs. The limbs left
+ * out change the value by less than one part in 2^32.
+ */
+static double log2_abs(const Bigint *a)
+{
+	double top = a->limb[a->len - 1];
+	size_t rest = a->len - 1;
+
+	if (a->len > 1)
+	{
+		top = top * 4294967296.0 + a->limb[a->len - 2];
+		rest--;
+	}
+	return log2(top) + (double)rest * LIMB_BITS;
+}
+
+/*
+ * Tells whether a non-zero magnitude is a power of two and if so
+ * returns its exponent in *shift.
+ */
+static int pow2_shift(const Bigint *a, size_t *shift)
+{
+	limb_t top = a->limb[a->len - 1];
+
+	if (top & (top - 1))
+		return 0;
+	for (size_t i = 0; i + 1 < a->len; i++)
+		if (a->limb[i])
+			return 0;
+
+	*shift = (a->len - 1) * LIMB_BITS;
+	while (!(top & 1))
+	{
+		top >>= 1;
+		(*shift)++;
+	}
+	return 1;
+}
+
+/*
+ * r = sign * 2^(k * e): one limb set, written in O(result) time.
+ */
+static int pow2(Bigint *r, size_t k, uint64_t e, int sign)
+{
+	size_t bit = k * (size_t)e, n = bit / LIMB_BITS + 1;
+	if (bi_reserve(r, n) == FAILURE)
+		return FAILURE;
+
+	memset(r->limb, 0, (n - 1) * sizeof(limb_t));
+	r->limb[n - 1] = (limb_t)1 << (bit % LIMB_BITS);
+	r->len = n;
+	r->sign = sign;
+	return SUCCESS;
+}
+
+/*
+ * Exponent of a power as a 64-bit count (exp->len is at most 2).
+ */
+static uint64_t pow_count(const Bigint *exp)
+{
+	uint64_t e = exp->len ? exp->limb[0] : 0;
+	if (exp->len == 2)
+		e |= (uint64_t)exp->limb[1] << LIMB_BITS;
+	return e;
+}
+
+/*
+ * Function: bi_pow_fits
  * ------------------------
- * Computes the exponentiation of a big integer: head1 ^ head2
- * Uses recursive exponentiation by squaring for efficiency.
+ * Tells whether base ^ exp (exp non-negative) has at most
+ * pow_max_digits decimal digits. That is floor(exp * log10|base|) + 1
+ * digits: counted exactly for a power of ten (j * exp + 1), and from
+ * log2|base| otherwise, where the product is never a whole number.
+ * bi_pow() refuses exactly the powers this refuses, so a caller that
+ * checks first sees bi_pow() fail only for lack of memory.
+ *
+ * Returns:
+ *  1 if the power fits, 0 if it is too large.
+ */
+int bi_pow_fits(const Bigint *base, const Bigint *exp)
+{
+    // 0, 1 and -1 stay small for any exponent, as does exponent 0
+    if (exp->len == 0 || base->len == 0 || (base->len == 1 && base->limb[0] == 1))
+        return 1;
+
+    // Any exponent above 64 bits is far beyond the limit
+    if (exp->len > 2)
+        return 0;
+
+    size_t k;
+    uint64_t e = pow_count(exp);
+    if (bi_is_pow10(base, &k))
+        return e < pow_max_digits / k + 1 && k * e < pow_max_digits;
+
+    double bits = pow2_shift(base, &k) ? (double)k * (double)e : (double)e * log2_abs(base);
+    return bits * 0.30102999566398120 < (double)pow_max_digits;
+}
+
+/*
+ * Function: bi_pow10_zeros
+ * ------------------------
+ * Tells whether base ^ exp is ±10^k within the size limit, so a caller
+ * printing it in decimal can write a one and k zeroes (dw_pow10())
+ * without building or converting the power.
  *
  * Parameters:
- *  head1, tail1 : base number (as doubly linked list)
- *  head2, tail2 : exponent (as doubly linked list, non-negative)
- *  headR, tailR : result list (output)
+ *  base, exp : the power (exp may be negative; that is never 10^k)
+ *  zeros     : receives k
+ *  sign      : receives the sign of the result
  *
  * Returns:
- *  SUCCESS if computation succeeds
- *  FAILURE on error (currently none for valid inputs)
+ *  1 for such a power, 0 otherwise.
+ */
+int bi_pow10_zeros(const Bigint *base, const Bigint *exp, size_t *zeros, int *sign)
+{
+    size_t j;
+    if (exp->sign < 0 || exp->len == 0 || !bi_pow_fits(base, exp) || !bi_is_pow10(base, &j))
+        return 0;
+
+    *zeros = j * (size_t)pow_count(exp);
+    *sign = (base->sign < 0 && (exp->limb[0] & 1)) ? -1 : 1;
+    return 1;
+}
+
+/*
+ * Function: bi_pow
+ * ------------------------
+ * Computes the exponentiation of a Bigint: r = base ^ exp
+ * Left-to-right binary exponentiation over the bits of the exponent:
+ * square for every bit, multiply by the base when the bit is set.
+ * A power-of-two base is a single bit shift and a power-of-ten base is
+ * built from the cached powers of ten; both skip the loop.
+ * Otherwise the result size, about exp * log2|base| bits, is known up front, so
+ * both working buffers are allocated once at full size and each step
+ * writes into the other buffer and swaps, without copying.
  *
- * Notes:
- *  - Exponent must be non-negative.
- *  - Uses division by 2 to implement fast exponentiation.
- *  - Multiplication is used to combine results.
+ * Returns:
+ *  SUCCESS if computation succeeds
+ *  FAILURE if the exponent is negative, the result would exceed
+ *          pow_max_digits digits or memory allocation fails
  */
-int power(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
+int bi_pow(Bigint *r, const Bigint *base, const Bigint *exp)
 {
+    if (exp->sign < 0)
+        return FAILURE;
+
     // Case: exponent = 0 → result = 1
-    if(*head2 == NULL)
+    if (exp->len == 0)
+        return bi_set_u32(r, 1);
+
+    int sign = (base->sign < 0 && (exp->limb[0] & 1)) ? -1 : 1;
+
+    // Case: base = 0, 1 or -1 → result stays small for any exponent
+    if (base->len == 0)
+        return bi_set_u32(r, 0);
+    if (base->len == 1 && base->limb[0] == 1)
     {
-        dl_delete_list(headR, tailR);
-        dl_insert_last(headR, tailR, 1);
+        if (bi_set_u32(r, 1) == FAILURE)
+            return FAILURE;
+        r->sign = sign;
         return SUCCESS;
     }
 
-    // Create a list representing 1
-    Dlist *oneH = NULL, *oneT = NULL;
-    dl_insert_last(&oneH, &oneT, 1);
-    
-    // Case: exponent = 1 → result = base
-    if(compare_list(*head2, oneH) == 0)
+    // Size the result against the limit
+    if (!bi_pow_fits(base, exp))
+        return FAILURE;
+    uint64_t e = pow_count(exp);
+
+    // Case: |base| = 2^k → result is the single bit k * exp
+    size_t k;
+    if (pow2_shift(base, &k))
+        return pow2(r, k, e, sign);
+
+    // Case: |base| = 10^j → result is 10^(j * exp) from the radix power cache
+    if (bi_is_pow10(base, &k))
     {
-        dl_delete_list(headR, tailR);
-        copy_list(headR, tailR, *head1);    
-        dl_delete_list(&oneH, &oneT);
+        if (bi_pow10(r, k * (size_t)e) == FAILURE)
+            return FAILURE;
+        r->sign = sign;
         return SUCCESS;
     }
-    dl_delete_list(&oneH, &oneT);  // free temporary '1' list
-    
-    // Create a list representing 2
-    Dlist *twoH = NULL, *twoT = NULL;
-    dl_insert_last(&twoH, &twoT, 2);
-    
-    // Divide exponent by 2 → halfH / halfT
-    Dlist *halfH = NULL, *halfT = NULL;
-    division(head2, tail2, &twoH, &twoH, &halfH, &halfT);
-    dl_delete_list(&twoH, &twoT); // free temporary '2' list
-    
-    // Recursive call: temp = base ^ (exponent / 2)
-    Dlist *tempH = NULL, *tempT = NULL;
-    power(head1, tail1, &halfH, &halfT, &tempH, &tempT);
-    dl_delete_list(&halfH, &halfT);
-
-    // Square the result: temp * temp
-    Dlist *mulH = NULL, *mulT = NULL;
-    multiplication(&tempH, &tempT, &tempH, &tempT, &mulH, &mulT);
-    dl_delete_list(&tempH, &tempT);
-
-    // If exponent is odd → multiply once more by base
-    int lsd = (*tail2)->data;  // least significant digit
-    if (lsd % 2 != 0)
+
+    double bits = (double)e * log2_abs(base);
+
+    // Squares and products never pass the final size by more than a few limbs
+    size_t cap = (size_t)(bits / LIMB_BITS) + base->len + 4;
+
+    Bigint x, y;
+    bi_init(&x);
+    bi_init(&y);
+    if (bi_reserve(&x, cap) == FAILURE || bi_reserve(&y, cap) == FAILURE)
+    {
+        bi_free(&x);
+        bi_free(&y);
+        return FAILURE;
+    }
+
+    // Start from the top bit of the exponent with x = |base|
+    int top = 63;
+    while (!((e >> top) & 1))
+        top--;
+    memcpy(x.limb, base->limb, base->len * sizeof(limb_t));
+    x.len = base->len;
+
+    int status = SUCCESS;
+    for (int i = top - 1; i >= 0 && status == SUCCESS; i--)
     {
-        Dlist *tmpH = NULL, *tmpT = NULL;
-        multiplication(&mulH, &mulT, head1, tail1, &tmpH, &tmpT);
-        dl_delete_list(&mulH, &mulT);
-        mulH = tmpH;
-        mulT = tmpT;
+        // y = x^2, then swap
+        status = limb_sqr(y.limb, x.limb, x.len);
+        y.len = 2 * x.len;
+        bi_normalize(&y);
+        bi_swap(&x, &y);
+
+        // If the bit is set → y = x * base, then swap
+        if (status == SUCCESS && ((e >> i) & 1))
+        {
+            status = limb_mul(y.limb, x.limb, x.len, base->limb, base->len);
+            y.len = x.len + base->len;
+            bi_normalize(&y);
+            bi_swap(&x, &y);
+        }
     }
 
-    // Clear any existing data in the output list before copying the result
-    dl_delete_list(headR, tailR);
+    // Hand the computed power over to the output without copying
+    if (status == SUCCESS)
+    {
+        x.sign = sign;
+        bi_swap(r, &x);
+    }
 
-    // Copy the computed power result into the output list
-    copy_list(headR, tailR, mulH);
+    bi_free(&x);
+    bi_free(&y);
+    return status;
+}
 
-    // Free temporary multiplication result
-    dl_delete_list(&mulH, &mulT);
+/*
+ * Tells whether a digit list is 10^j for some j > 0 (a one followed
+ * only by zeroes) and if so returns j in *zeros. A lone 1 is left to
+ * bi_pow(), which answers |base| = 1 for any exponent.
+ */
+static int is_power_of_ten(const Dlist *head, size_t *zeros)
+{
+    if (head == NULL || head->data != 1)
+        return 0;
+
+    *zeros = 0;
+    for (head = head->next; head; head = head->next)
+    {
+        if (head->data != 0)
+            return 0;
+        (*zeros)++;
+    }
+    return *zeros > 0;
+}
+
+/*
+ * Function: power_of_ten
+ * ------------------------
+ * Tells whether head1 ^ head2 is 10^k: a base of 10^j raised to exp
+ * is a one followed by j * exp zeroes, which the caller writes out
+ * directly (dw_pow10()) with no arithmetic, no base conversion and no
+ * digit list.
+ *
+ * Parameters:
+ *  head1 : base number (as doubly linked list)
+ *  head2 : exponent (as doubly linked list, non-negative)
+ *  zeros : receives k
+ *
+ * Returns:
+ *  1 for a power of ten within pow_max_digits digits, 0 otherwise
+ *  (any other base, or a result power() then rejects as too large).
+ */
+int power_of_ten(const Dlist *head1, const Dlist *head2, size_t *zeros)
+{
+    size_t j, e = 0;
+    if (!is_power_of_ten(head1, &j))
+        return 0;
+
+    // j * e zeroes must stay within the limit, so e cannot overflow
+    for (; head2; head2 = head2->next)
+    {
+        e = e * 10 + head2->data;
+        if (e > pow_max_digits / j)
+            return 0;
+    }
+    *zeros = j * e;
+    return 1;
+}
+
+/*
+ * Function: power
+ * ------------------------
+ * Computes the exponentiation of a big integer: head1 ^ head2
+ * The operands are converted to Bigints and handed to bi_pow().
+ *
+ * Parameters:
+ *  head1, tail1 : base number (as doubly linked list)
+ *  head2, tail2 : exponent (as doubly linked list, non-negative)
+ *  headR, tailR : result list (output)
+ *
+ * Returns:
+ *  SUCCESS if computation succeeds
+ *  FAILURE on memory allocation failure or a result over the size limit
+ *
+ * Notes:
+ *  - Exponent must be non-negative.
+ *  - Powers of ten are better checked first with power_of_ten().
+ */
+int power(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
+{
+    Bigint a, b, r;
+    bi_init(&a);
+    bi_init(&b);
+    bi_init(&r);
+
+    int status = FAILURE;
+    if (bi_from_list(&b, *head2) == SUCCESS && bi_from_list(&a, *head1) == SUCCESS && bi_pow(&r, &a, &b) == SUCCESS)
+    {
+        // Clear any existing data in the output list before writing the result
+        dl_delete_list(headR, tailR);
+        status = bi_to_list(headR, tailR, &r);
+    }
 
-    return SUCCESS;
-}
\ No newline at end of file
+    bi_free(&a);
+    bi_free(&b);
+    bi_free(&r);
+    return status;
+}
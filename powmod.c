@@ -0,0 +1,255 @@
+/***********************************************************************
+ *  File Name   : powmod.c
+ *  Description : Source file for modular exponentiation in the
+ *                Arbitrary Precision Calculator (APC).
+ *                Computes base ^ exp mod m with left-to-right
+ *                sliding-window exponentiation over a modulus context,
+ *                so no intermediate grows beyond twice the size of the
+ *                modulus whatever the size of the exponent.
+ *
+ *                Functions:
+ *                - bi_powmod() / bi_powmod_ctx()
+ *                - power_mod()
+ *
+ *  Notes       :
+ *  - Odd moduli below toom3_threshold limbs run in Montgomery form;
+ *    even and larger moduli use Barrett reduction after each product,
+ *    which then runs on the fast multiplication tiers.
+ *  - The window width grows with the exponent length; the table holds
+ *    the odd powers base^1, base^3 ... base^(2^k - 1).
+ *  - The result is always in 0 .. |m| - 1.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "list.h"
+#include "bigint.h"
+
+#define POWMOD_MAX_WINDOW 6
+
+/*
+ * Modular product in Montgomery form (mont set) or with Barrett reduction.
+ */
+static int mulmod(Bigint *r, const Bigint *a, const Bigint *b, const Bimod *ctx, int mont)
+{
+	return mont ? bi_mont_mul(r, a, b, ctx) : bi_mod_mul(r, a, b, ctx);
+}
+
+/*
+ * Window width for an exponent of the given bit length: the table
+ * costs 2^(k-1) products, each window saves about k of them.
+ */
+static int window_bits(size_t bits)
+{
+	if (bits > 671)
+		return 6;
+	if (bits > 239)
+		return 5;
+	if (bits > 79)
+		return 4;
+	if (bits > 23)
+		return 3;
+	if (bits > 7)
+		return 2;
+	return 1;
+}
+
+/*
+ * Returns bit i of a magnitude.
+ */
+static int exp_bit(const Bigint *e, size_t i)
+{
+	return (e->limb[i / LIMB_BITS] >> (i % LIMB_BITS)) & 1;
+}
+
+/*
+ * Fills table[j] = g^(2j + 1) for j < entries; g is squared in place.
+ */
+static int make_table(Bigint *table, size_t entries, Bigint *g, const Bimod *ctx, int mont)
+{
+	if (bi_copy(&table[0], g) == FAILURE)
+		return FAILURE;
+	if (entries > 1 && mulmod(g, g, g, ctx, mont) == FAILURE)
+		return FAILURE;
+
+	for (size_t j = 1; j < entries; j++)
+		if (mulmod(&table[j], &table[j - 1], g, ctx, mont) == FAILURE)
+			return FAILURE;
+	return SUCCESS;
+}
+
+/*
+ * Left-to-right sliding window over the exponent bits: a zero bit
+ * costs one squaring, and a run of up to k bits ending in a one costs
+ * one squaring per bit and a single multiplication by a table entry.
+ * acc comes in as 1 and leaves as g^exp, both in working form.
+ */
+static int slide(Bigint *acc, const Bigint *exp, const Bigint *table, int k, const Bimod *ctx, int mont)
+{
+	size_t bits = exp->len * LIMB_BITS;
+	while (bits && !exp_bit(exp, bits - 1))
+		bits--;
+
+	int started = 0;
+	for (size_t i = bits; i-- > 0;)
+	{
+		if (!exp_bit(exp, i))
+		{
+			if (mulmod(acc, acc, acc, ctx, mont) == FAILURE)
+				return FAILURE;
+			continue;
+		}
+
+		// Longest window i .. low of at most k bits that ends in a one
+		size_t low = i + 1 >= (size_t)k ? i + 1 - k : 0;
+		while (!exp_bit(exp, low))
+			low++;
+
+		size_t value = 0;
+		for (size_t b = i + 1; b-- > low;)
+			value = 2 * value + exp_bit(exp, b);
+
+		if (!started)
+		{
+			// First window: skip the squarings of 1
+			if (bi_copy(acc, &table[value / 2]) == FAILURE)
+				return FAILURE;
+			started = 1;
+		}
+		else
+		{
+			for (size_t b = low; b <= i; b++)
+				if (mulmod(acc, acc, acc, ctx, mont) == FAILURE)
+					return FAILURE;
+			if (mulmod(acc, acc, &table[value / 2], ctx, mont) == FAILURE)
+				return FAILURE;
+		}
+		i = low;
+	}
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_powmod_ctx
+ * -----------------------
+ * Modular exponentiation against a prepared modulus context:
+ * r = base ^ exp mod m, for exp >= 0. A negative base is taken to its
+ * non-negative residue first, so the result is always in 0 .. m - 1.
+ * The context is only read, so callers may share one.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if exp < 0 or memory allocation fails.
+ */
+int bi_powmod_ctx(Bigint *r, const Bigint *base, const Bigint *exp, const Bimod *ctx)
+{
+	if (exp->sign < 0)
+		return FAILURE;
+
+	// REDC is a schoolbook pass, so large moduli do better with Barrett
+	int mont = ctx->odd && ctx->n < toom3_threshold;
+
+	Bigint g, acc, table[1 << (POWMOD_MAX_WINDOW - 1)];
+	int k = window_bits(exp->len * LIMB_BITS);
+	size_t entries = (size_t)1 << (k - 1);
+
+	bi_init(&g);
+	bi_init(&acc);
+	for (size_t i = 0; i < entries; i++)
+		bi_init(&table[i]);
+
+	// g = base mod m in 0 .. m-1 and acc = 1, both moved into working form,
+	// then the odd powers, the scan, and the way back out
+	int status = FAILURE;
+	if (bi_mod_reduce(&g, base, ctx) == SUCCESS &&
+		(g.sign > 0 || bi_add(&g, &g, &ctx->m) == SUCCESS) &&
+		bi_set_u32(&acc, 1) == SUCCESS && bi_mod_reduce(&acc, &acc, ctx) == SUCCESS &&
+		(!mont || (bi_mont_in(&g, &g, ctx) == SUCCESS && bi_mont_in(&acc, &acc, ctx) == SUCCESS)) &&
+		make_table(table, entries, &g, ctx, mont) == SUCCESS &&
+		slide(&acc, exp, table, k, ctx, mont) == SUCCESS &&
+		(!mont || bi_mont_out(&acc, &acc, ctx) == SUCCESS))
+	{
+		bi_swap(r, &acc);
+		status = SUCCESS;
+	}
+
+	bi_free(&g);
+	bi_free(&acc);
+	for (size_t i = 0; i < entries; i++)
+		bi_free(&table[i]);
+	return status;
+}
+
+/*
+ * Function: bi_powmod
+ * -------------------
+ * Modular exponentiation: r = base ^ exp mod |m|, for exp >= 0 and
+ * m != 0, with a context built for this call (see bi_powmod_ctx()).
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if exp < 0, m == 0 or memory allocation fails.
+ */
+int bi_powmod(Bigint *r, const Bigint *base, const Bigint *exp, const Bigint *m)
+{
+	if (exp->sign < 0 || m->len == 0)
+		return FAILURE;
+
+	Bimod ctx;
+	if (bi_mod_init(&ctx, m) == FAILURE)
+		return FAILURE;
+
+	int status = bi_powmod_ctx(r, base, exp, &ctx);
+	bi_mod_free(&ctx);
+	return status;
+}
+
+/*
+ * Function: power_mod
+ * -------------------
+ * Computes num1 ^ num2 mod num3 for numbers held as digit lists.
+ * The handles carry the operand signs, which matter here: a negative
+ * base changes the residue, not just the sign of the result.
+ *
+ * Parameters:
+ *  num1         : base
+ *  num2         : exponent (non-negative)
+ *  num3         : modulus (non-zero)
+ *  headR, tailR : result list (output)
+ *
+ * Returns:
+ *  SUCCESS if computation succeeds
+ *  FAILURE if the modulus is zero or on memory allocation failure
+ */
+int power_mod(const Dnum *num1, const Dnum *num2, const Dnum *num3, Dlist **headR, Dlist **tailR)
+{
+	// Check for modulo by zero
+	if (num3->head == NULL)
+	{
+		fprintf(stderr, "❌ ERROR: Modulo by zero !\n");
+		return FAILURE;
+	}
+
+	Bigint a, b, m, r;
+	bi_init(&a);
+	bi_init(&b);
+	bi_init(&m);
+	bi_init(&r);
+
+	int status = FAILURE;
+	if (bi_from_list(&a, num1->head) == SUCCESS && bi_from_list(&b, num2->head) == SUCCESS &&
+		bi_from_list(&m, num3->head) == SUCCESS)
+	{
+		if (a.len)
+			a.sign = num1->sign;
+		if (bi_powmod(&r, &a, &b, &m) == SUCCESS)
+			status = bi_to_list(headR, tailR, &r);
+	}
+
+	bi_free(&a);
+	bi_free(&b);
+	bi_free(&m);
+	bi_free(&r);
+	return status;
+}
@@ -0,0 +1,554 @@
+/***********************************************************************
+ *  File Name   : radix.c
+ *  Description : Source file for decimal <-> binary conversion in the
+ *                Arbitrary Precision Calculator (APC).
+ *                Long decimal numbers are converted by divide and conquer:
+ *                parsing splits the digit string in two and joins the
+ *                halves with one multiplication by a power of ten, and
+ *                printing splits the number with one division by the
+ *                same power, so both directions ride on the fast
+ *                multiplication and division tiers.
+ *
+ *                Functions:
+ *                - bi_from_digits()
+ *                - bi_pow10() / bi_is_pow10()
+ *                - bi_digits_bound()
+ *                - bi_to_digits()
+ *                - bi_from_radix2() / bi_radix2_bound() / bi_to_radix2()
+ *                - bi_from_text()
+ *
+ *  Notes       :
+ *  - The split points are 10^(9 * 2^k). These powers are kept in a
+ *    process-wide cache, built by repeated squaring on first use, so
+ *    every later conversion of a similar size reuses them. Entries are
+ *    published with a release store of the count and never change
+ *    afterwards, so threads read them without locking; only growing
+ *    the cache takes a lock.
+ *  - Below radix_dc_threshold limbs both directions fall back to the
+ *    nine-digits-per-limb-pass loops, which are quadratic but have the
+ *    smallest constant.
+ *  - Binary, octal and hexadecimal need no arithmetic at all: every
+ *    digit is a fixed slice of bits, so those conversions are linear.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <math.h>
+#include <pthread.h>
+#include "apc.h"
+#include "bigint.h"
+
+#define DEC_CHUNK        1000000000u   // 10^9, largest power of ten in a limb
+#define DEC_CHUNK_DIGITS 9
+#define POW10_CACHE_MAX  48            // 10^(9 * 2^47) is far beyond memory
+
+size_t radix_dc_threshold = RADIX_DC_THRESHOLD;
+
+/* pow10_cache[k] = 10^(9 * 2^k), filled in order on demand */
+static Bigint pow10_cache[POW10_CACHE_MAX];
+static size_t pow10_count;
+static pthread_mutex_t pow10_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Returns 10^(9 * 2^k) from the cache, squaring up to it if needed,
+ * or NULL if memory allocation fails. Safe to call from any thread.
+ */
+static const Bigint *pow10_get(size_t k)
+{
+	// Entries below the published count are complete
+	if (k < __atomic_load_n(&pow10_count, __ATOMIC_ACQUIRE))
+		return &pow10_cache[k];
+
+	pthread_mutex_lock(&pow10_lock);
+	int status = SUCCESS;
+	if (pow10_count == 0)
+	{
+		bi_init(&pow10_cache[0]);
+		status = bi_set_u32(&pow10_cache[0], DEC_CHUNK);
+		if (status == SUCCESS)
+			__atomic_store_n(&pow10_count, 1, __ATOMIC_RELEASE);
+	}
+
+	while (status == SUCCESS && pow10_count <= k)
+	{
+		Bigint *next = &pow10_cache[pow10_count];
+		bi_init(next);
+		status = bi_sqr(next, &pow10_cache[pow10_count - 1]);
+		if (status == SUCCESS)
+			__atomic_store_n(&pow10_count, pow10_count + 1, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&pow10_lock);
+	return status == SUCCESS ? &pow10_cache[k] : NULL;
+}
+
+/*
+ * Largest k with 9 * 2^k <= n / 2 (n >= 18): the split that keeps the
+ * low part at least a quarter and at most a half of n digits.
+ */
+static size_t split_level(size_t n)
+{
+	size_t k = 0;
+	while (((size_t)DEC_CHUNK_DIGITS << (k + 1)) <= n / 2)
+		k++;
+	return k;
+}
+
+/*
+ * Nine-digit chunk loop for short strings: a = value of s[0 .. n).
+ * Every digit of a conversion passes through here exactly once, so
+ * this is also where the digits are checked.
+ */
+static int from_digits_basecase(Bigint *a, const char *s, size_t n)
+{
+	a->len = 0;
+	a->sign = 1;
+
+	// A short leading chunk first, then whole chunks of nine
+	size_t head = n % DEC_CHUNK_DIGITS;
+	limb_t chunk = 0, scale = 1;
+	unsigned bad = 0;
+	for (size_t i = 0; i < head; i++)
+	{
+		unsigned d = (unsigned char)s[i] - '0';
+		bad |= d > 9;
+		chunk = chunk * 10 + d;
+		scale *= 10;
+	}
+	if (bad || (head && bi_mul_1_add(a, scale, chunk) == FAILURE))
+		return FAILURE;
+
+	for (size_t i = head; i < n; i += DEC_CHUNK_DIGITS)
+	{
+		chunk = 0;
+		for (size_t j = 0; j < DEC_CHUNK_DIGITS; j++)
+		{
+			unsigned d = (unsigned char)s[i + j] - '0';
+			bad |= d > 9;
+			chunk = chunk * 10 + d;
+		}
+		if (bad || bi_mul_1_add(a, DEC_CHUNK, chunk) == FAILURE)
+			return FAILURE;
+	}
+
+	bi_normalize(a);
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_from_digits
+ * ------------------------
+ * Converts n decimal digits (most significant first, no sign) into a
+ * non-negative Bigint, checking each digit as it is read.
+ *
+ * Long strings split as hi * 10^L + lo with L = 9 * 2^k close to n/2
+ * and recurse on both halves.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on a character that is not a digit or if
+ *  memory allocation fails (a is then left partly written).
+ */
+int bi_from_digits(Bigint *a, const char *s, size_t n)
+{
+	// About 9.6 digits fit in a limb; 9 keeps the estimate on the safe side
+	if (n / DEC_CHUNK_DIGITS < radix_dc_threshold || n < 2 * DEC_CHUNK_DIGITS)
+		return from_digits_basecase(a, s, n);
+
+	size_t k = split_level(n);
+	size_t low = (size_t)DEC_CHUNK_DIGITS << k;
+	const Bigint *p = pow10_get(k);
+	if (p == NULL)
+		return FAILURE;
+
+	Bigint hi, lo;
+	bi_init(&hi);
+	bi_init(&lo);
+
+	int status = FAILURE;
+	if (bi_from_digits(&hi, s, n - low) == SUCCESS &&
+		bi_from_digits(&lo, s + n - low, low) == SUCCESS &&
+		bi_mul(a, &hi, p) == SUCCESS && bi_add(a, a, &lo) == SUCCESS)
+		status = SUCCESS;
+
+	bi_free(&hi);
+	bi_free(&lo);
+	return status;
+}
+
+/*
+ * Function: bi_pow10
+ * ------------------
+ * r = 10^k. When the radix power cache already holds 10^k it is
+ * copied; otherwise r = 5^k * 2^k, the odd part raised by bi_pow()'s
+ * squaring loop on a number 30% shorter than 10^k, then shifted.
+ * (Multiplying cached powers together costs more than that: their
+ * products are unbalanced full multiplications, not squarings.)
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int bi_pow10(Bigint *r, size_t k)
+{
+	size_t q = k / DEC_CHUNK_DIGITS, i = 0;
+	while (((size_t)1 << i) < q)
+		i++;
+	if (k % DEC_CHUNK_DIGITS == 0 && q == (size_t)1 << i &&
+		i < __atomic_load_n(&pow10_count, __ATOMIC_ACQUIRE))
+		return bi_copy(r, &pow10_cache[i]);
+
+	Bigint five, e;
+	bi_init(&five);
+	bi_init(&e);
+
+	int status = FAILURE;
+	if (bi_set_u32(&five, 5) == SUCCESS && bi_reserve(&e, 2) == SUCCESS)
+	{
+		e.limb[0] = (limb_t)k;
+		e.limb[1] = (limb_t)((uint64_t)k >> LIMB_BITS);
+		e.len = 2;
+		bi_normalize(&e);
+		status = bi_pow(r, &five, &e);
+	}
+
+	// r <<= k in place, from the top limb down: the bit shift moves
+	// every limb up by whole limbs, and zeroes fill the bottom
+	size_t words = k / LIMB_BITS, n = r->len;
+	unsigned bits = k % LIMB_BITS;
+	if (status == SUCCESS && (status = bi_reserve(r, n + words + 1)) == SUCCESS)
+	{
+		limb_t *p = r->limb;
+		p[n + words] = bits ? p[n - 1] >> (LIMB_BITS - bits) : 0;
+		for (size_t j = n; j-- > 0;)
+			p[j + words] = p[j] << bits | (bits && j ? p[j - 1] >> (LIMB_BITS - bits) : 0);
+		memset(p, 0, words * sizeof(limb_t));
+		r->len = n + words + 1;
+		bi_normalize(r);
+	}
+
+	bi_free(&five);
+	bi_free(&e);
+	return status;
+}
+
+/*
+ * Function: bi_is_pow10
+ * ---------------------
+ * Tells whether |a| is 10^j for some j > 0 and if so returns j in *j.
+ * 10^j = 2^j * 5^j, so j is the number of trailing zero bits; only a
+ * number of the matching bit length is compared against 10^j itself.
+ */
+int bi_is_pow10(const Bigint *a, size_t *j)
+{
+	if (a->len == 0)
+		return 0;
+
+	size_t t = 0, i = 0;
+	while (a->limb[i] == 0)
+	{
+		i++;
+		t += LIMB_BITS;
+	}
+	for (limb_t low = a->limb[i]; !(low & 1); low >>= 1)
+		t++;
+	if (t == 0)
+		return 0;
+
+	// 10^t has floor(t * log2(10)) + 1 bits; allow for rounding
+	size_t bits = (a->len - 1) * LIMB_BITS;
+	for (limb_t top = a->limb[a->len - 1]; top; top >>= 1)
+		bits++;
+	double expect = floor((double)t * 3.3219280948873623) + 1;
+	if ((double)bits < expect - 1 || (double)bits > expect + 1)
+		return 0;
+
+	Bigint p;
+	bi_init(&p);
+	int match = bi_pow10(&p, t) == SUCCESS && bi_cmp_abs(a, &p) == 0;
+	bi_free(&p);
+	if (match)
+		*j = t;
+	return match;
+}
+
+/*
+ * Function: bi_digits_bound
+ * -------------------------
+ * Upper bound on the number of decimal digits of |a|, at least 1.
+ * Over-estimates by at most one digit: bits * log10(2) rounded up.
+ */
+size_t bi_digits_bound(const Bigint *a)
+{
+	if (a->len == 0)
+		return 1;
+
+	size_t bits = (a->len - 1) * LIMB_BITS;
+	for (limb_t top = a->limb[a->len - 1]; top; top >>= 1)
+		bits++;
+
+	// log10(2) < 30103 / 100000, split to avoid overflow on huge counts
+	return bits / 100000 * 30103 + (bits % 100000) * 30103 / 100000 + 1;
+}
+
+/*
+ * Writes exactly width digits of a < 10^width into buf, zero padded,
+ * nine digits per limb pass from the low end.
+ */
+static int to_digits_basecase(char *buf, size_t width, const Bigint *a)
+{
+	Bigint t;
+	bi_init(&t);
+	if (bi_copy(&t, a) == FAILURE)
+		return FAILURE;
+
+	char *p = buf + width;
+	while (p > buf)
+	{
+		limb_t chunk = t.len ? bi_divrem_1(&t, DEC_CHUNK) : 0;
+		for (int i = 0; i < DEC_CHUNK_DIGITS && p > buf; i++)
+		{
+			*--p = (char)('0' + chunk % 10);
+			chunk /= 10;
+		}
+	}
+
+	bi_free(&t);
+	return SUCCESS;
+}
+
+/*
+ * Writes exactly width digits of a < 10^width into buf, zero padded:
+ * a = q * 10^L + r, with q filling the first width - L digits and r
+ * the last L.
+ */
+static int to_digits(char *buf, size_t width, const Bigint *a)
+{
+	if (a->len < radix_dc_threshold || width < 2 * DEC_CHUNK_DIGITS)
+		return to_digits_basecase(buf, width, a);
+
+	size_t k = split_level(width);
+	size_t low = (size_t)DEC_CHUNK_DIGITS << k;
+	const Bigint *p = pow10_get(k);
+	if (p == NULL)
+		return FAILURE;
+
+	Bigint q, r;
+	bi_init(&q);
+	bi_init(&r);
+
+	int status = FAILURE;
+	if (bi_divmod(&q, &r, a, p) == SUCCESS &&
+		to_digits(buf, width - low, &q) == SUCCESS &&
+		to_digits(buf + width - low, low, &r) == SUCCESS)
+		status = SUCCESS;
+
+	bi_free(&q);
+	bi_free(&r);
+	return status;
+}
+
+/*
+ * Function: bi_to_digits
+ * ----------------------
+ * Writes the magnitude of a in decimal, without leading zeroes and
+ * NUL terminated, into buf. Zero is written as "0".
+ *
+ * Parameters:
+ *  buf : output, at least bi_digits_bound(a) + 1 bytes
+ *  n   : number of digits written (output)
+ *  a   : value to convert (its sign is ignored)
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int bi_to_digits(char *buf, size_t *n, const Bigint *a)
+{
+	Bigint t = *a;
+	t.sign = 1;
+
+	size_t width = bi_digits_bound(a);
+	if (to_digits(buf, width, &t) == FAILURE)
+		return FAILURE;
+
+	// The bound may leave one leading zero; keep a single digit for zero
+	size_t skip = 0;
+	while (skip + 1 < width && buf[skip] == '0')
+		skip++;
+	memmove(buf, buf + skip, width - skip);
+	buf[width - skip] = '\0';
+	*n = width - skip;
+	return SUCCESS;
+}
+
+/*
+ * Value of a hexadecimal digit character, or 16 if it is not one.
+ */
+static unsigned digit_value(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	c = (char)tolower((unsigned char)c);
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return 16;
+}
+
+/*
+ * Function: bi_from_radix2
+ * ------------------------
+ * Converts n digits in base 2^bits (bits = 1, 3 or 4: binary, octal or
+ * hexadecimal; most significant first, no sign or prefix) into a
+ * non-negative Bigint. Each digit is ORed into place at bit offset
+ * bits * (its position from the end), so the cost is linear.
+ * Each digit is checked against the base as it is read.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on a digit outside the base or if memory
+ *  allocation fails (a is then left partly written).
+ */
+int bi_from_radix2(Bigint *a, const char *s, size_t n, unsigned bits)
+{
+	size_t limbs = (n * bits + LIMB_BITS - 1) / LIMB_BITS;
+	if (bi_reserve(a, limbs) == FAILURE)
+		return FAILURE;
+	if (limbs)
+		memset(a->limb, 0, limbs * sizeof(limb_t));
+
+	size_t pos = 0;
+	for (size_t i = n; i-- > 0; pos += bits)
+	{
+		limb_t v = digit_value(s[i]);
+		if (v >> bits)
+			return FAILURE;
+		size_t k = pos / LIMB_BITS;
+		unsigned sh = pos % LIMB_BITS;
+
+		a->limb[k] |= v << sh;
+		if (sh + bits > LIMB_BITS)
+			a->limb[k + 1] |= v >> (LIMB_BITS - sh);
+	}
+
+	a->len = limbs;
+	a->sign = 1;
+	bi_normalize(a);
+	return SUCCESS;
+}
+
+/*
+ * Number of base 2^bits digits of |a| (at least 1); exact.
+ */
+size_t bi_radix2_bound(const Bigint *a, unsigned bits)
+{
+	if (a->len == 0)
+		return 1;
+
+	size_t len = (a->len - 1) * LIMB_BITS;
+	for (limb_t top = a->limb[a->len - 1]; top; top >>= 1)
+		len++;
+	return (len + bits - 1) / bits;
+}
+
+/*
+ * Function: bi_to_radix2
+ * ----------------------
+ * Writes the magnitude of a in base 2^bits (bits = 1, 3 or 4) with
+ * lower-case digits, without leading zeroes and NUL terminated, by
+ * slicing bits straight out of the limbs. buf needs
+ * bi_radix2_bound(a, bits) + 1 bytes.
+ *
+ * Returns:
+ *  the number of digits written
+ */
+size_t bi_to_radix2(char *buf, const Bigint *a, unsigned bits)
+{
+	static const char digits[] = "0123456789abcdef";
+	size_t n = bi_radix2_bound(a, bits);
+	limb_t mask = ((limb_t)1 << bits) - 1;
+
+	for (size_t i = 0, pos = 0; i < n; i++, pos += bits)
+	{
+		size_t k = pos / LIMB_BITS;
+		unsigned sh = pos % LIMB_BITS;
+		limb_t v = k < a->len ? a->limb[k] >> sh : 0;
+
+		if (sh + bits > LIMB_BITS && k + 1 < a->len)
+			v |= a->limb[k + 1] << (LIMB_BITS - sh);
+		buf[n - 1 - i] = digits[v & mask];
+	}
+	buf[n] = '\0';
+	return n;
+}
+
+/*
+ * Trims operand text and reads its sign and base prefix, leaving
+ * [*s, *end) on the digits; bits is 4, 3 or 1 for the power-of-two
+ * bases and 0 for decimal. The digits themselves are not read here:
+ * the conversion checks them in the same pass that converts them.
+ *
+ * Returns:
+ *  SUCCESS if at least one character is left for digits, FAILURE
+ *  otherwise.
+ */
+static int scan_text(const char **s, const char **end, int *sign, unsigned *bits)
+{
+	const char *p = *s, *e = *end;
+
+	while (p < e && isspace((unsigned char)*p))
+		p++;
+	while (e > p && isspace((unsigned char)e[-1]))
+		e--;
+	*sign = 1;
+	if (p < e && (*p == '-' || *p == '+'))
+		*sign = *p++ == '-' ? -1 : 1;
+
+	*bits = 0;
+	if (e - p >= 2 && p[0] == '0')
+	{
+		switch (tolower((unsigned char)p[1]))
+		{
+			case 'x':
+				*bits = 4;
+				break;
+			case 'o':
+				*bits = 3;
+				break;
+			case 'b':
+				*bits = 1;
+				break;
+		}
+		if (*bits)
+			p += 2;
+	}
+	*s = p;
+	*end = e;
+	return p == e ? FAILURE : SUCCESS;
+}
+
+/*
+ * Function: bi_from_text
+ * ----------------------
+ * Parses n characters of operand text: optional blanks, an optional
+ * '+' or '-', an optional "0x", "0o" or "0b" prefix, at least one digit
+ * of that base, optional blanks. Power-of-two bases take the linear
+ * path; decimal goes through bi_from_digits(). The digits are checked
+ * while they are converted, so a long operand is read once.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on invalid text (a is then left partly
+ *  written) or if memory allocation fails.
+ */
+int bi_from_text(Bigint *a, const char *s, size_t n)
+{
+	const char *end = s + n;
+	int sign;
+	unsigned bits;
+
+	if (scan_text(&s, &end, &sign, &bits) == FAILURE)
+		return FAILURE;
+
+	if ((bits ? bi_from_radix2(a, s, end - s, bits) : bi_from_digits(a, s, end - s)) == FAILURE)
+		return FAILURE;
+	if (a->len)
+		a->sign = sign;
+	return SUCCESS;
+}
@@ -0,0 +1,263 @@
+/***********************************************************************
+ *  File Name   : serial.c
+ *  Description : Source file for the binary file format of the
+ *                Arbitrary Precision Calculator (APC).
+ *                A Bigint is stored as a fixed header followed by its
+ *                raw limbs, so passing a number between runs costs a
+ *                copy of the limbs instead of two radix conversions.
+ *
+ *                Functions:
+ *                - bi_save() / bi_load()
+ *                - bi_view_record() / bi_is_record()
+ *                - bi_map() / bi_unmap()
+ *
+ *  Notes       :
+ *  - Layout, version 1 (16-byte header, limbs start 4-byte aligned):
+ *      0  "APCB"   magic
+ *      4  u8       version (BI_SERIAL_VERSION)
+ *      5  u8       byte order of the count and limbs: 0 little, 1 big
+ *      6  u8       bytes per limb (4)
+ *      7  i8       sign, +1 or -1 (zero is stored as +1)
+ *      8  u64      limb count n
+ *      16 n limbs, least significant first
+ *  - Files are written in the byte order of the machine that saved
+ *    them; a loader on the other byte order swaps while copying.
+ *  - Several records may follow each other in one stream.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "apc.h"
+#include "bigint.h"
+
+#define SERIAL_HEADER 16
+
+static const char serial_magic[4] = { 'A', 'P', 'C', 'B' };
+
+/*
+ * Byte order of this machine: 0 little endian, 1 big endian.
+ */
+static int host_order(void)
+{
+	const uint16_t probe = 1;
+	return *(const uint8_t *)&probe == 0;
+}
+
+/*
+ * Reverses the bytes of a limb.
+ */
+static limb_t swap_limb(limb_t x)
+{
+	return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+/*
+ * Checks a header and extracts its fields.
+ *
+ * Returns:
+ *  SUCCESS for a supported header, FAILURE otherwise.
+ */
+static int parse_header(const unsigned char *h, int *order, int *sign, uint64_t *n)
+{
+	if (memcmp(h, serial_magic, 4) != 0 || h[4] != BI_SERIAL_VERSION ||
+		h[5] > 1 || h[6] != sizeof(limb_t) || (h[7] != 1 && h[7] != 0xff))
+		return FAILURE;
+
+	*order = h[5];
+	*sign = h[7] == 1 ? 1 : -1;
+
+	*n = 0;
+	for (int i = 0; i < 8; i++)
+		*n |= (uint64_t)h[8 + (*order ? i : 7 - i)] << (8 * (7 - i));
+	return SUCCESS;
+}
+
+/*
+ * Finishes n limbs already in a->limb: swaps them to this machine's
+ * byte order if needed, then fixes length and sign.
+ */
+static void finish_limbs(Bigint *a, size_t n, int order, int sign)
+{
+	if (order != host_order())
+		for (size_t i = 0; i < n; i++)
+			a->limb[i] = swap_limb(a->limb[i]);
+
+	a->len = n;
+	a->sign = sign;
+	bi_normalize(a);
+}
+
+/*
+ * Function: bi_save
+ * -----------------
+ * Writes a Bigint as one binary record in this machine's byte order.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if the stream cannot be written.
+ */
+int bi_save(const Bigint *a, FILE *out)
+{
+	unsigned char h[SERIAL_HEADER];
+	uint64_t n = a->len;
+	int order = host_order();
+
+	memcpy(h, serial_magic, 4);
+	h[4] = BI_SERIAL_VERSION;
+	h[5] = (unsigned char)order;
+	h[6] = sizeof(limb_t);
+	h[7] = a->sign < 0 ? 0xff : 1;
+	for (int i = 0; i < 8; i++)
+		h[8 + (order ? i : 7 - i)] = (unsigned char)(n >> (8 * (7 - i)));
+
+	if (fwrite(h, 1, SERIAL_HEADER, out) != SERIAL_HEADER ||
+		fwrite(a->limb, sizeof(limb_t), a->len, out) != a->len)
+		return FAILURE;
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_load
+ * -----------------
+ * Reads the next binary record from a stream into a, swapping the
+ * limbs if they were saved on a machine of the other byte order.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE on a malformed or short record or if memory
+ *  allocation fails.
+ */
+int bi_load(Bigint *a, FILE *in)
+{
+	unsigned char h[SERIAL_HEADER];
+	int order, sign;
+	uint64_t n;
+
+	if (fread(h, 1, SERIAL_HEADER, in) != SERIAL_HEADER || parse_header(h, &order, &sign, &n) == FAILURE ||
+		n > SIZE_MAX / sizeof(limb_t) || bi_reserve(a, n) == FAILURE)
+		return FAILURE;
+	if (fread(a->limb, sizeof(limb_t), n, in) != n)
+		return FAILURE;
+
+	finish_limbs(a, n, order, sign);
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_view_record
+ * ------------------------
+ * Loads the binary record at the start of size bytes of memory. When
+ * it was saved in this machine's byte order and its limbs are aligned,
+ * a becomes a read-only view of the limbs in place (*view set to 1)
+ * and nothing is copied; otherwise the limbs are copied, and swapped
+ * if needed, into storage of its own (*view set to 0).
+ *
+ * A view may be used as an operand anywhere, but must not be a result
+ * argument, and is only valid while the memory is. Release it with
+ * bi_init(), and a copy with bi_free().
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if the memory does not hold a complete valid
+ *  record or on memory allocation failure.
+ */
+int bi_view_record(Bigint *a, const void *p, size_t size, int *view)
+{
+	const unsigned char *h = p;
+	int order, sign;
+	uint64_t n;
+
+	*view = 0;
+	if (size < SERIAL_HEADER || parse_header(h, &order, &sign, &n) == FAILURE ||
+		n > (size - SERIAL_HEADER) / sizeof(limb_t))
+		return FAILURE;
+
+	const unsigned char *limbs = h + SERIAL_HEADER;
+	if (order != host_order() || (uintptr_t)limbs % sizeof(limb_t) != 0)
+	{
+		if (bi_reserve(a, n) == FAILURE)
+			return FAILURE;
+		memcpy(a->limb, limbs, n * sizeof(limb_t));
+		finish_limbs(a, n, order, sign);
+		return SUCCESS;
+	}
+
+	bi_free(a);
+	a->limb = (limb_t *)limbs;
+	a->len = a->cap = n;
+	a->sign = sign;
+	while (a->len && a->limb[a->len - 1] == 0)
+		a->len--;
+	if (a->len == 0)
+		a->sign = 1;
+	*view = 1;
+	return SUCCESS;
+}
+
+/*
+ * Function: bi_map
+ * ----------------
+ * Loads the first record of a binary file through a private mapping of
+ * it, with bi_view_record(): when the byte order matches, a is a
+ * read-only view of the mapping and nothing is copied.
+ * Release it with bi_unmap(), not bi_free().
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if the file cannot be read, is not a valid
+ *  record, or on memory allocation failure.
+ */
+int bi_map(Bigint *a, Bimap *map, const char *path)
+{
+	map->addr = NULL;
+	map->size = 0;
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return FAILURE;
+
+	struct stat st;
+	void *p = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size >= SERIAL_HEADER)
+		p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED)
+		return FAILURE;
+
+	// Keep the mapping only while a points into it
+	int view, status = bi_view_record(a, p, st.st_size, &view);
+	if (status == SUCCESS && view)
+	{
+		map->addr = p;
+		map->size = st.st_size;
+	}
+	else
+		munmap(p, st.st_size);
+	return status;
+}
+
+/*
+ * Releases a Bigint loaded with bi_map(), whether mapped or copied,
+ * and resets it to zero.
+ */
+void bi_unmap(Bigint *a, Bimap *map)
+{
+	if (map->addr)
+	{
+		munmap(map->addr, map->size);
+		map->addr = NULL;
+		bi_init(a);
+	}
+	else
+		bi_free(a);
+}
+
+/*
+ * Returns 1 if size bytes at p start with the binary record magic.
+ */
+int bi_is_record(const void *p, size_t size)
+{
+	return size >= sizeof serial_magic && memcmp(p, serial_magic, sizeof serial_magic) == 0;
+}
@@ -0,0 +1,230 @@
+/***********************************************************************
+ *  File Name   : square.c
+ *  Description : Source file for squaring in the Arbitrary Precision
+ *                Calculator (APC).
+ *                Squaring needs each cross product a[i] * a[j] only
+ *                once, so it has its own kernels: a schoolbook square
+ *                that doubles the off-diagonal sum, a Karatsuba square
+ *                built on (a0 - a1)^2, and the NTT with a single
+ *                forward transform.
+ *
+ *                Functions:
+ *                - limb_sqr_basecase()
+ *                - limb_sqr_karatsuba()
+ *                - limb_sqr()
+ *                - bi_sqr()
+ *                - square()
+ *
+ *  Notes       :
+ *  - Crossovers are sqr_karatsuba_threshold and sqr_ntt_threshold
+ *    (in limbs); the Toom-3 range shares toom3_threshold.
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "list.h"
+#include "bigint.h"
+
+size_t sqr_karatsuba_threshold = SQR_KARATSUBA_THRESHOLD;
+size_t sqr_ntt_threshold = SQR_NTT_THRESHOLD;
+
+/*
+ * Function: limb_sqr_basecase
+ * ---------------------------
+ * Schoolbook square of n limbs into 2n limbs.
+ * The products a[i] * a[j] with i < j are summed once, the sum is
+ * doubled with a one-bit shift and the squares a[i]^2 are added on the
+ * diagonal: about half the limb products of limb_mul_basecase().
+ *
+ * r must not overlap a.
+ */
+void limb_sqr_basecase(limb_t *r, const limb_t *a, size_t n)
+{
+	r[0] = 0;
+	r[2 * n - 1] = 0;
+
+	/* Off-diagonal triangle, one row per limb */
+	if (n > 1)
+	{
+		r[n] = limb_mul_1(r + 1, a + 1, n - 1, a[0]);
+		for (size_t i = 1; i + 1 < n; i++)
+			r[n + i] = limb_addmul_1(r + 2 * i + 1, a + i + 1, n - i - 1, a[i]);
+	}
+
+	/* Double the triangle */
+	limb_t carry = 0;
+	for (size_t k = 0; k < 2 * n; k++)
+	{
+		limb_t t = r[k];
+		r[k] = (t << 1) | carry;
+		carry = t >> (LIMB_BITS - 1);
+	}
+
+	/* Add the diagonal squares */
+	dlimb_t c = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		dlimb_t sq = (dlimb_t)a[i] * a[i];
+		dlimb_t s = (dlimb_t)r[2 * i] + (limb_t)sq + c;
+		r[2 * i] = (limb_t)s;
+		s = (dlimb_t)r[2 * i + 1] + (sq >> LIMB_BITS) + (s >> LIMB_BITS);
+		r[2 * i + 1] = (limb_t)s;
+		c = s >> LIMB_BITS;
+	}
+}
+
+/*
+ * Recursive Karatsuba square:
+ *   a = a1 * B^m + a0,  d = (a0 - a1)^2
+ *   a^2 = a1^2 * B^2m + (a0^2 + a1^2 - d) * B^m + a0^2
+ * d is a square, so it is never negative and needs no sign tracking.
+ * ws must hold 3m limbs plus the scratch of a size-m recursion.
+ */
+static void sqr_rec(limb_t *r, const limb_t *a, size_t n, limb_t *ws)
+{
+	if (n < sqr_karatsuba_threshold || n < 2)
+	{
+		limb_sqr_basecase(r, a, n);
+		return;
+	}
+
+	size_t m = (n + 1) / 2, l1 = n - m;
+	limb_t *da = ws, *d = ws + m, *next = ws + 3 * m;
+
+	// d = (a0 - a1)^2
+	limb_diff(da, a, m, a + m, l1);
+	sqr_rec(d, da, m, next);
+
+	// a0^2 into the low half of r, a1^2 into the high half
+	sqr_rec(r, a, m, next);
+	sqr_rec(r + 2 * m, a + m, l1, next);
+
+	// Middle term a0^2 + a1^2 - d, built in place of d
+	long carry = -(long)limb_sub_n(d, r, d, 2 * m);
+	carry += limb_add(d, d, 2 * m, r + 2 * m, 2 * l1);
+
+	// Middle term is never negative, so carry ends up in 0..1; add it at offset m
+	limb_add(r + m, r + m, 2 * n - m, d, 2 * m);
+	if (carry > 0)
+		limb_add_1(r + 3 * m, r + 3 * m, 2 * n - 3 * m, (limb_t)carry);
+}
+
+/*
+ * Function: limb_sqr_karatsuba
+ * ----------------------------
+ * Karatsuba square of n limbs into 2n limbs. r must not overlap a.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if the scratch buffer cannot be allocated.
+ */
+int limb_sqr_karatsuba(limb_t *r, const limb_t *a, size_t n)
+{
+	/* Each level needs 3 * ceil(n/2) limbs plus the level below: < 3n + 3 log n */
+	limb_t *ws = malloc((3 * n + 3 * 64) * sizeof(limb_t));
+	if (ws == NULL)
+		return FAILURE;
+
+	sqr_rec(r, a, n, ws);
+	free(ws);
+	return SUCCESS;
+}
+
+/*
+ * Function: limb_sqr
+ * ------------------
+ * Square of a limb array: r[0 .. 2n) = a^2, picking the algorithm by size:
+ *   schoolbook square    below sqr_karatsuba_threshold limbs
+ *   Karatsuba square     below toom3_threshold limbs
+ *   Toom-3 square        below sqr_ntt_threshold limbs
+ *   NTT square           above that, up to NTT_MAX_LEN limbs of result
+ * r must not overlap a.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if scratch memory cannot be allocated.
+ */
+int limb_sqr(limb_t *r, const limb_t *a, size_t n)
+{
+	if (n < sqr_karatsuba_threshold)
+	{
+		limb_sqr_basecase(r, a, n);
+		return SUCCESS;
+	}
+	if (n < toom3_threshold)
+		return limb_sqr_karatsuba(r, a, n);
+	if (n >= sqr_ntt_threshold && 2 * n <= NTT_MAX_LEN)
+		return limb_mul_ntt(r, a, n, a, n);
+	return limb_mul_toom3(r, a, n, a, n);
+}
+
+/*
+ * Function: bi_sqr
+ * ----------------
+ * Squares a Bigint: r = a * a. The result is never negative.
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int bi_sqr(Bigint *r, const Bigint *a)
+{
+	if (a->len == 0)
+		return bi_set_u32(r, 0);
+
+	/* Square goes straight into r's storage, or into a separate buffer
+	 * when r aliases a */
+	Bigint t, *p = r;
+	bi_init(&t);
+	if (bi_alias(r, a))
+		p = &t;
+	if (bi_reserve(p, 2 * a->len) == FAILURE)
+		return FAILURE;
+
+	if (limb_sqr(p->limb, a->limb, a->len) == FAILURE)
+	{
+		bi_free(&t);
+		return FAILURE;
+	}
+
+	p->len = 2 * a->len;
+	p->sign = 1;
+	bi_normalize(p);
+
+	if (p == &t)
+		bi_swap(r, &t);
+	bi_free(&t);
+	return SUCCESS;
+}
+
+/*
+ * Function: square
+ * ----------------
+ * Squares a big integer represented as a doubly linked list.
+ *
+ * Parameters:
+ *  head1, tail1 : number to square (as a doubly linked list)
+ *  headR, tailR : result list (will store the square)
+ *
+ * Returns:
+ *  SUCCESS if squaring succeeds,
+ *  FAILURE if memory allocation fails.
+ */
+int square(Dlist **head1, Dlist **tail1, Dlist **headR, Dlist **tailR)
+{
+	/* Square of an empty (zero) number is zero */
+	if (*head1 == NULL)
+		return SUCCESS;
+
+	Bigint a, r;
+	bi_init(&a);
+	bi_init(&r);
+
+	int status = FAILURE;
+	if (bi_from_list(&a, *head1) == SUCCESS && bi_sqr(&r, &a) == SUCCESS)
+		status = bi_to_list(headR, tailR, &r);
+
+	bi_free(&a);
+	bi_free(&r);
+	return status;
+}
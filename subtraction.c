@@ -3,15 +3,22 @@
  *  Description : Source file for subtraction operation in the
  *                Arbitrary Precision Calculator (APC).
  *                Implements subtraction of two large integers
- *                stored as doubly linked lists.
+ *                stored as Bigint limb arrays, plus the list-based
+ *                entry point used by the calculator.
  *
  *                Functions:
+ *                - limb_sub_n()
+ *                - limb_sub_1()
+ *                - limb_sub()
+ *                - limb_diff()
+ *                - bi_sub_abs()
+ *                - bi_sub()
  *                - subtraction()
  *
  *  Notes       :
- *  - Digits are subtracted from least significant to most significant.
- *  - Borrowing is handled explicitly when the minuend digit < subtrahend digit.
- *  - Leading zeros in the result are removed.
+ *  - Limbs are subtracted from least significant to most significant.
+ *  - Borrowing is handled explicitly when the minuend limb < subtrahend limb.
+ *  - Leading zero limbs in the result are removed.
  *  - Works even if numbers are of different lengths.
  *
  *  Author      : Pankaj Kumar
@@ -21,11 +28,148 @@
 
 #include "apc.h"
 #include "list.h"
+#include "bigint.h"
+
+/* 
+ * Function: limb_sub_n
+ * --------------------
+ * Subtracts two limb arrays of the same length: r = a - b.
+ *
+ * Returns:
+ *   the borrow out of the top limb (0 or 1)
+ */
+limb_t limb_sub_n(limb_t *r, const limb_t *a, const limb_t *b, size_t n)
+{
+	limb_t borrow = 0;  // flag to manage borrowing during subtraction
+
+	for (size_t i = 0; i < n; i++)
+	{
+		dlimb_t sub = (dlimb_t)b[i] + borrow;
+		limb_t digit = a[i];
+
+		r[i] = digit - (limb_t)sub;
+		borrow = (dlimb_t)digit < sub;
+	}
+	return borrow;
+}
+
+/* 
+ * Function: limb_sub_1
+ * --------------------
+ * Subtracts a single limb from an array: r = a - c.
+ *
+ * Returns:
+ *   the borrow out of the top limb (0 or 1)
+ */
+limb_t limb_sub_1(limb_t *r, const limb_t *a, size_t n, limb_t c)
+{
+	size_t i = 0;
+
+	for (; i < n && c; i++)
+	{
+		limb_t digit = a[i];
+		r[i] = digit - c;
+		c = digit < c;
+	}
+	if (r != a)
+		for (; i < n; i++)
+			r[i] = a[i];
+	return c;
+}
+
+/* 
+ * Function: limb_sub
+ * ------------------
+ * Subtracts a shorter array from a longer one: r[0 .. na) = a - b, na >= nb.
+ *
+ * Returns:
+ *   the borrow out of the top limb (0 or 1)
+ */
+limb_t limb_sub(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	limb_t borrow = limb_sub_n(r, a, b, nb);
+	return limb_sub_1(r + nb, a + nb, na - nb, borrow);
+}
+
+/* 
+ * Function: limb_diff
+ * -------------------
+ * Stores |a - b| in r[0 .. na) for na >= nb; a may carry leading zeros.
+ *
+ * Returns:
+ *   1 if a >= b, -1 if a < b
+ */
+int limb_diff(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	size_t n = na;
+	while (n > nb && a[n - 1] == 0)
+		n--;
+
+	if (n > nb || limb_cmp(a, b, nb) >= 0)
+	{
+		limb_sub(r, a, na, b, nb);
+		return 1;
+	}
+
+	// b > a, so the limbs of a above nb are all zero
+	limb_sub_n(r, b, a, nb);
+	memset(r + nb, 0, (na - nb) * sizeof(limb_t));
+	return -1;
+}
+
+/* 
+ * Function: bi_sub_abs
+ * --------------------
+ * Subtracts magnitudes: r = |a| - |b|. The caller guarantees |a| >= |b|.
+ *
+ * Returns:
+ *   SUCCESS on success, FAILURE if memory allocation fails
+ */
+int bi_sub_abs(Bigint *r, const Bigint *a, const Bigint *b)
+{
+	size_t len_a = a->len, len_b = b->len;
+	if (bi_reserve(r, len_a) == FAILURE)
+		return FAILURE;
+
+	limb_sub(r->limb, a->limb, len_a, b->limb, len_b);
+
+	r->len = len_a;
+	r->sign = 1;
+	bi_normalize(r);
+	return SUCCESS;
+}
+
+/* 
+ * Function: bi_sub
+ * ----------------
+ * Signed subtraction r = a - b, expressed as addition of the negated b.
+ */
+int bi_sub(Bigint *r, const Bigint *a, const Bigint *b)
+{
+	/* r aliasing b would invalidate the shallow view below, so go through a temporary */
+	if (r == b)
+	{
+		Bigint t;
+		bi_init(&t);
+		int status = bi_sub(&t, a, b);
+		if (status == SUCCESS)
+			bi_swap(r, &t);
+		bi_free(&t);
+		return status;
+	}
+
+	Bigint neg = *b;     // shallow view of b with the sign flipped
+	if (neg.len)
+		neg.sign = -b->sign;
+
+	return bi_add(r, a, &neg);
+}
 
 /* 
  * Function: subtraction
  * ---------------------
  * Performs subtraction of two numbers stored in doubly linked lists.
+ * The caller guarantees Operand1 >= Operand2.
  *
  * Parameters:
  *   head1, tail1 → doubly linked list for Operand1 (minuend)
@@ -34,12 +178,12 @@
  *
  * Returns:
  *   SUCCESS on successful subtraction
- *   FAILURE if input lists are NULL
+ *   FAILURE if memory allocation fails
  * 
  */
 int subtraction(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlist **headR, Dlist **tailR)
 {
-	/* Check if any operand list is NULL → invalid input */
+	/* Check if any operand list is NULL → result is the other operand */
 	if (*head1 == NULL)
 	{
 		copy_list(headR, tailR, *head2);
@@ -50,35 +194,19 @@ int subtraction(Dlist **head1, Dlist **tail1, Dlist **head2, Dlist **tail2, Dlis
 		copy_list(headR, tailR, *head1);
 		return SUCCESS;
 	}
-	/* Start subtraction from the last digits (tails) */
-	Dlist *temp1 = *tail1, *temp2 = *tail2;
-	int borrow = 0;  // flag to manage borrowing during subtraction
 
-	/* Loop until both lists are fully traversed */
-	while (temp1 || temp2)
-	{
-		/* Extract digits (0 if one list is shorter) */
-		int digit1 = temp1 ? temp1->data : 0;
-		int digit2 = temp2 ? temp2->data : 0;
-
-		/* Adjust digit1 if borrowing is needed */
-		int subtract = digit1 - digit2 - borrow;
-
-        if (subtract < 0) {
-            subtract += 10;
-            borrow = 1;
-        } else {
-            borrow = 0;
-        }
-		/* Insert the result digit at the beginning of result list */
-		dl_insert_first(headR, tailR, subtract);
-
-		/* Move to previous digits */
-		if (temp1)
-			temp1 = temp1->prev;
-		if (temp2)
-			temp2 = temp2->prev;
-	}
-	delete_leading_zero(headR, tailR);
-	return SUCCESS;
+	Bigint a, b, r;
+	bi_init(&a);
+	bi_init(&b);
+	bi_init(&r);
+
+	int status = FAILURE;
+	if (bi_from_list(&a, *head1) == SUCCESS && bi_from_list(&b, *head2) == SUCCESS &&
+		bi_sub_abs(&r, &a, &b) == SUCCESS)
+		status = bi_to_list(headR, tailR, &r);
+
+	bi_free(&a);
+	bi_free(&b);
+	bi_free(&r);
+	return status;
 }
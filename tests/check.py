@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+# ***********************************************************************
+#  File Name   : tests/check.py
+#  Description : Randomised check of the Arbitrary Precision Calculator
+#                (APC) against Python's own integers.
+#                Generates '<a> <op> <b>' and '<base> ^ <exp> mod <m>'
+#                lines with operands from one digit up past the NTT
+#                crossover, runs them through 'calc.out --batch' (in
+#                decimal and in base 16) and compares every result.
+#                Power limit cases are run one per process, since a
+#                refused line ends a batch.
+#
+#                Usage:
+#                  tests/check.py <calc.out> [--seed n] [--count n]
+#                                 [--pow-limit n]
+#
+#  Notes:
+#  - 'make check' runs it on the normal build and on one built with
+#    every threshold set to a few limbs, so the same small operands
+#    go through each multiplication, squaring, division, reduction
+#    and conversion tier and across every crossover.
+#  - --pow-limit is the POW_MAX_DIGITS the calculator was built with;
+#    powers right at that limit must be accepted or refused exactly.
+#
+#  Author      : Pankaj Kumar
+#  Roll No     : 25008_018
+#  Date        : 17-Oct-2026
+# ***********************************************************************
+
+import argparse
+import random
+import subprocess
+import sys
+
+sys.set_int_max_str_digits(0)
+
+# Operand sizes in decimal digits: every default crossover lies below
+# the largest, which are kept to a few lines as Python's own decimal
+# conversion is quadratic
+SIZES = [1, 3, 9, 10, 19, 20, 60, 300, 500, 1000, 1500, 3500, 8000]
+HUGE = [85000, 170000]
+
+
+def operand(digits):
+    """Random signed number with up to the given number of digits."""
+    return random.choice([-1, 1]) * random.randint(0, 10 ** digits - 1)
+
+
+def text(v, hexa):
+    """Operand text, in decimal or as a 0x literal."""
+    if hexa:
+        return ('-' if v < 0 else '') + hex(abs(v))
+    return str(v)
+
+
+def truncated(a, b):
+    """Quotient rounded toward zero and the remainder with a's sign."""
+    q = abs(a) // abs(b)
+    if (a < 0) != (b < 0):
+        q = -q
+    return q, a - q * b
+
+
+def cases(count):
+    """Lines for --batch and the results expected for each."""
+    lines, want = [], []
+    for i in range(count):
+        op = random.choice('+-x*/%d^M')
+        a = operand(random.choice(SIZES))
+        b = operand(random.choice(SIZES))
+        hexa = random.random() < 0.15
+        if op in '/%d' and b == 0:
+            b = 7
+        if random.random() < 0.1 and op in 'x*':
+            b = a                                  # squaring kernels
+        if random.random() < 0.1 and op in '/%d':
+            b = operand(random.choice(SIZES[:8])) or 3
+
+        if op == '^':
+            a = operand(random.choice(SIZES[:7]))
+            if random.random() < 0.2:
+                a = random.choice([-1, 1]) * 10 ** random.randint(1, 30)
+            b = random.randint(0, 600 // len(str(abs(a))))   # under the limit
+            lines.append(f'{text(a, hexa)} ^ {b}')
+            want.append([a ** b])
+        elif op == 'M':
+            m = operand(random.choice(SIZES[:11])) or 11
+            e = random.randint(0, 10 ** random.choice([1, 5, 40, 120]))
+            lines.append(f'{text(a, hexa)} ^ {e} mod {m}')
+            want.append([pow(a, e, abs(m))])
+        else:
+            lines.append(f'{text(a, hexa)} {op} {text(b, False)}')
+            if op == '+':
+                want.append([a + b])
+            elif op == '-':
+                want.append([a - b])
+            elif op in 'x*':
+                want.append([a * b])
+            else:
+                q, r = truncated(a, b)
+                want.append([q] if op == '/' else [r] if op == '%' else [q, r])
+
+    # Past the NTT crossovers: long products, a square and a division
+    for d in HUGE:
+        a, b = operand(d), operand(d // 2)
+        lines += [f'{a} x {b}', f'{a} x {a}', f'{a} d {b or 1}']
+        q, r = truncated(a, b or 1)
+        want += [[a * b], [a * a], [q, r]]
+    return lines, want
+
+
+def run_batch(calc, lines, base):
+    out = subprocess.run([calc, '--raw', '--base', str(base), '--batch'],
+                         input='\n'.join(lines) + '\n', capture_output=True, text=True)
+    if out.returncode != 0:
+        print(f'base {base}: calc.out failed: {out.stderr.strip()}')
+        return None
+    return out.stdout.split('\n')
+
+
+def check_batch(calc, lines, want):
+    bad = 0
+    for base in (10, 16):
+        got = run_batch(calc, lines, base)
+        if got is None:
+            return 1
+        for line, w, g in zip(lines, want, got):
+            if [int(v, 0) for v in g.split()] != w:
+                bad += 1
+                if bad <= 5:
+                    print(f'base {base}: {line[:60]}: got {g[:40]}')
+        if len(got) - 1 != len(lines):
+            print(f'base {base}: {len(got) - 1} results for {len(lines)} lines')
+            bad += 1
+    return bad
+
+
+def check_pow_limit(calc, limit):
+    """Powers either side of the limit, on the list path and --batch."""
+    bad = 0
+    for b in [2, 3, 7, 10, -10, 100, 999, 2 ** 40, 10 ** 17]:
+        e0 = int(limit / len(str(abs(b))))
+        while len(str(abs(b) ** e0)) <= limit:
+            e0 += 1
+        for e in (e0 - 1, e0):
+            fits = len(str(abs(b) ** e)) <= limit
+            runs = [subprocess.run([calc, '--raw', str(b), '^', str(e)],
+                                   capture_output=True, text=True),
+                    subprocess.run([calc, '--raw', '--batch'], input=f'{b} ^ {e}\n',
+                                   capture_output=True, text=True)]
+            for r in runs:
+                ok = (r.returncode == 0) == fits
+                if ok and fits:
+                    ok = int(r.stdout) == b ** e
+                if not ok:
+                    bad += 1
+                    print(f'limit {limit}: {b} ^ {e} (fits: {fits}) exit {r.returncode}')
+    return bad
+
+
+def main():
+    p = argparse.ArgumentParser()
+    p.add_argument('calc')
+    p.add_argument('--seed', type=int, default=1)
+    p.add_argument('--count', type=int, default=1500)
+    p.add_argument('--pow-limit', type=int, default=0)
+    args = p.parse_args()
+
+    random.seed(args.seed)
+    lines, want = cases(args.count)
+    bad = check_batch(args.calc, lines, want)
+    if args.pow_limit:
+        bad += check_pow_limit(args.calc, args.pow_limit)
+
+    print(f'{args.calc}: {len(lines)} lines, {bad} failures')
+    return 1 if bad else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,158 @@
+/***********************************************************************
+ *  File Name   : toom3.c
+ *  Description : Source file for Toom-Cook 3-way multiplication in the
+ *                Arbitrary Precision Calculator (APC).
+ *                Splits each operand into three parts, evaluates the
+ *                part polynomials at 0, 1, -1, -2 and infinity, forms
+ *                five third-size products and interpolates the result
+ *                with exact divisions by 2 and 3.
+ *
+ *                Functions:
+ *                - limb_mul_toom3()
+ *
+ *  Notes       :
+ *  - The crossover is toom3_threshold (in limbs). It defaults to
+ *    TOOM3_THRESHOLD and can be changed at build time with
+ *    -DTOOM3_THRESHOLD=n or at run time by assigning the variable.
+ *  - Point values can be negative, so evaluation and interpolation
+ *    run on signed Bigints; the five products go back through
+ *    bi_mul() and so recurse into whichever tier fits their size.
+ *  - When both operands are the same array, only one side is
+ *    evaluated and the point products go through bi_sqr().
+ *
+ *  Author      : Pankaj Kumar
+ *  Roll No     : 25008_018
+ *  Date        : 16-Oct-2026
+ ***********************************************************************/
+
+#include "apc.h"
+#include "bigint.h"
+
+size_t toom3_threshold = TOOM3_THRESHOLD;
+
+/*
+ * Wraps a slice of a limb array as a read-only Bigint without copying.
+ */
+static Bigint view(const limb_t *p, size_t n)
+{
+	Bigint v;
+
+	while (n && p[n - 1] == 0)
+		n--;
+	v.limb = (limb_t *)p;
+	v.len = v.cap = n;
+	v.sign = 1;
+	return v;
+}
+
+/*
+ * Evaluates x2 * t^2 + x1 * t + x0 at t = 1, -1 and -2.
+ */
+static int evaluate(Bigint *v1, Bigint *vm1, Bigint *vm2, const Bigint *x0, const Bigint *x1, const Bigint *x2)
+{
+	// v1 = x0 + x1 + x2, vm1 = x0 - x1 + x2
+	if (bi_add(vm2, x0, x2) == FAILURE || bi_add(v1, vm2, x1) == FAILURE ||
+		bi_sub(vm1, vm2, x1) == FAILURE)
+		return FAILURE;
+
+	// vm2 = 2 * (vm1 + x2) - x0 = x0 - 2 x1 + 4 x2
+	if (bi_add(vm2, vm1, x2) == FAILURE || bi_add(vm2, vm2, vm2) == FAILURE)
+		return FAILURE;
+	return bi_sub(vm2, vm2, x0);
+}
+
+/*
+ * Adds a non-negative coefficient into r[off .. n).
+ */
+static void accumulate(limb_t *r, size_t n, size_t off, const Bigint *c)
+{
+	if (c->len)
+		limb_add(r + off, r + off, n - off, c->limb, c->len);
+}
+
+/*
+ * Function: limb_mul_toom3
+ * ------------------------
+ * Toom-3 product of two limb arrays into na + nb limbs.
+ * Needs na >= nb > 2 * ceil(na / 3) so that both operands have three
+ * non-empty parts. r must not overlap a or b.
+ *
+ * Interpolation (Bodrato's sequence for points 0, 1, -1, -2, inf):
+ *   r3 = (r(-2) - r(1)) / 3
+ *   r1 = (r(1) - r(-1)) / 2
+ *   r2 = r(-1) - r(0)
+ *   r3 = (r2 - r3) / 2 + 2 r(inf)
+ *   r2 = r2 + r1 - r(inf)
+ *   r1 = r1 - r3
+ *
+ * Returns:
+ *  SUCCESS, or FAILURE if memory allocation fails.
+ */
+int limb_mul_toom3(limb_t *r, const limb_t *a, size_t na, const limb_t *b, size_t nb)
+{
+	size_t k = (na + 2) / 3, n = na + nb;
+
+	Bigint a0 = view(a, k), a1 = view(a + k, k), a2 = view(a + 2 * k, na - 2 * k);
+	Bigint b0 = view(b, k), b1 = view(b + k, k), b2 = view(b + 2 * k, nb - 2 * k);
+
+	Bigint p1, pm1, pm2, q1, qm1, qm2, r0, rinf;
+	Bigint *tmp[] = { &p1, &pm1, &pm2, &q1, &qm1, &qm2, &r0, &rinf };
+	for (size_t i = 0; i < sizeof(tmp) / sizeof(tmp[0]); i++)
+		bi_init(tmp[i]);
+
+	int status = FAILURE;
+
+	// Evaluate both operands, then form the five point products in place
+	if (a == b && na == nb)
+	{
+		// Squaring: one evaluation, and the point products are squares
+		if (evaluate(&p1, &pm1, &pm2, &a0, &a1, &a2) == SUCCESS &&
+			bi_sqr(&r0, &a0) == SUCCESS && bi_sqr(&rinf, &a2) == SUCCESS &&
+			bi_sqr(&p1, &p1) == SUCCESS && bi_sqr(&pm1, &pm1) == SUCCESS &&
+			bi_sqr(&pm2, &pm2) == SUCCESS)
+			status = SUCCESS;
+	}
+	else if (evaluate(&p1, &pm1, &pm2, &a0, &a1, &a2) == SUCCESS &&
+		evaluate(&q1, &qm1, &qm2, &b0, &b1, &b2) == SUCCESS &&
+		bi_mul(&r0, &a0, &b0) == SUCCESS && bi_mul(&rinf, &a2, &b2) == SUCCESS &&
+		bi_mul(&p1, &p1, &q1) == SUCCESS && bi_mul(&pm1, &pm1, &qm1) == SUCCESS &&
+		bi_mul(&pm2, &pm2, &qm2) == SUCCESS)
+		status = SUCCESS;
+
+	if (status == SUCCESS)
+	{
+		status = FAILURE;
+
+		// From here on p1 holds r1, pm1 holds r2 and pm2 holds r3
+		if (bi_sub(&pm2, &pm2, &p1) == SUCCESS && bi_sub(&p1, &p1, &pm1) == SUCCESS &&
+			bi_sub(&pm1, &pm1, &r0) == SUCCESS)
+		{
+			bi_divrem_1(&pm2, 3);
+			bi_divrem_1(&p1, 2);
+
+			if (bi_sub(&pm2, &pm1, &pm2) == SUCCESS)
+			{
+				bi_divrem_1(&pm2, 2);
+				if (bi_add(&pm2, &pm2, &rinf) == SUCCESS && bi_add(&pm2, &pm2, &rinf) == SUCCESS &&
+					bi_add(&pm1, &pm1, &p1) == SUCCESS && bi_sub(&pm1, &pm1, &rinf) == SUCCESS &&
+					bi_sub(&p1, &p1, &pm2) == SUCCESS)
+					status = SUCCESS;
+			}
+		}
+	}
+
+	// Recompose r0 + r1 x + r2 x^2 + r3 x^3 + r(inf) x^4 with x = B^k
+	if (status == SUCCESS)
+	{
+		memset(r, 0, n * sizeof(limb_t));
+		accumulate(r, n, 0, &r0);
+		accumulate(r, n, k, &p1);
+		accumulate(r, n, 2 * k, &pm1);
+		accumulate(r, n, 3 * k, &pm2);
+		accumulate(r, n, 4 * k, &rinf);
+	}
+
+	for (size_t i = 0; i < sizeof(tmp) / sizeof(tmp[0]); i++)
+		bi_free(tmp[i]);
+	return status;
+}